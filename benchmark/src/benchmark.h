@@ -0,0 +1,270 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/safeptr.h>
+#include <audio/utility/realtimechecker.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace benchmark
+        {
+
+            /**
+             * @return Name of the vector extension backend the module is compiled with, see vectorextension.h.
+             */
+            inline const char* getBackendName()
+            {
+#ifdef _WIN32
+                return "intel";
+#else
+                return "simde";
+#endif
+            }
+
+
+            /**
+             * Repeatedly calls a function that processes a block of samples and measures the time per sample.
+             * The measurement is repeated for a number of rounds and the fastest round is returned, to reduce the influence of other processes.
+             * @param samplesPerCall Number of samples processed by one call of the function.
+             * @param function The function to be measured.
+             * @param minimumSeconds Minimum total duration of the measurement.
+             * @param rounds Number of rounds.
+             * @return Time in nanoseconds per sample.
+             */
+            template <typename Function>
+            double measure(int samplesPerCall, Function&& function, double minimumSeconds = 0.2, int rounds = 5)
+            {
+                using Clock = std::chrono::steady_clock;
+                auto roundDuration = std::chrono::duration<double>(minimumSeconds / rounds);
+                auto best = std::numeric_limits<double>::max();
+
+                // Warm up caches and lazily initialized state
+                function();
+
+                for (auto round = 0; round < rounds; ++round)
+                {
+                    long long calls = 0;
+                    auto start = Clock::now();
+                    auto elapsed = Clock::duration::zero();
+                    do {
+                        function();
+                        calls++;
+                        elapsed = Clock::now() - start;
+                    } while (elapsed < roundDuration);
+
+                    auto nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+                    best = std::min(best, nanoseconds / (double(calls) * samplesPerCall));
+                }
+                return best;
+            }
+
+
+            /**
+             * Prints the result of a measurement to stdout as a single line JSON object.
+             * @param name Name of the benchmark.
+             * @param bufferSize Buffer size the benchmark was run with.
+             * @param nanosecondsPerSample The result of the measurement.
+             */
+            inline void printResult(const std::string& name, int bufferSize, double nanosecondsPerSample)
+            {
+                std::cout << "{\"benchmark\": \"" << name << "\", \"backend\": \"" << getBackendName() << "\", \"bufferSize\": " << bufferSize << ", \"nsPerSample\": " << nanosecondsPerSample << "}" << std::endl;
+            }
+
+
+            /**
+             * Distribution of a series of measurements.
+             */
+            struct Percentiles
+            {
+                double mMedian = 0.0;
+                double mP90 = 0.0;
+                double mP99 = 0.0;
+                double mMaximum = 0.0;
+            };
+
+
+            /**
+             * Calculates the percentiles of a series of measurements using the nearest rank method.
+             * @param values The measurements. Will be sorted in place.
+             * @return The percentiles, all zero if no values are given.
+             */
+            inline Percentiles getPercentiles(std::vector<double>& values)
+            {
+                Percentiles result;
+                if (values.empty())
+                    return result;
+
+                std::sort(values.begin(), values.end());
+                auto rank = [&](double fraction) { return values[std::min<size_t>(values.size() - 1, size_t(fraction * values.size()))]; };
+                result.mMedian = rank(0.5);
+                result.mP90 = rank(0.9);
+                result.mP99 = rank(0.99);
+                result.mMaximum = values.back();
+                return result;
+            }
+
+
+            /**
+             * Prints percentiles as a JSON object, without a trailing newline.
+             */
+            inline void printPercentiles(const Percentiles& percentiles)
+            {
+                std::cout << "{\"p50\": " << percentiles.mMedian << ", \"p90\": " << percentiles.mP90 << ", \"p99\": " << percentiles.mP99 << ", \"max\": " << percentiles.mMaximum << "}";
+            }
+
+
+            /**
+             * Parses the buffer sizes from the command line arguments, or returns the default sizes if none are given.
+             */
+            inline std::vector<int> getBufferSizes(int argc, char** argv)
+            {
+                std::vector<int> result;
+                for (auto i = 1; i < argc; ++i)
+                    result.emplace_back(std::atoi(argv[i]));
+                if (result.empty())
+                    result = { 32, 64, 128, 256, 512 };
+                return result;
+            }
+
+
+            /**
+             * @return A buffer with white noise between -1 and 1, generated with a fixed seed.
+             */
+            inline SampleBuffer createNoise(int size)
+            {
+                SampleBuffer result(size);
+                unsigned int state = 1;
+                for (auto& sample : result)
+                {
+                    state = state * 1664525u + 1013904223u;
+                    sample = (state >> 8) / float(1 << 23) - 1.f;
+                }
+                return result;
+            }
+
+
+            /**
+             * Node that outputs a fixed signal, used as a cheap input for the nodes being measured.
+             */
+            class SignalSource : public Node
+            {
+            public:
+                SignalSource(NodeManager& nodeManager, const SampleBuffer& signal) : Node(nodeManager), mSignal(signal) { }
+
+                OutputPin output = { this };
+
+            private:
+                void process() override
+                {
+                    auto& buffer = getOutputBuffer(output);
+                    for (auto i = 0; i < buffer.size(); ++i)
+                        buffer[i] = mSignal[i % mSignal.size()];
+                }
+
+                SampleBuffer mSignal;
+            };
+
+
+            /**
+             * Node that pulls its input, registered as root process to drive the nodes being measured.
+             */
+            class Sink : public Node
+            {
+            public:
+                Sink(NodeManager& nodeManager) : Node(nodeManager) { }
+
+                InputPin input = { this };
+
+            private:
+                void process() override { input.pull(); }
+            };
+
+
+            /**
+             * Standalone node manager that is processed directly instead of by an audio device.
+             * Has to be constructed before and destructed after the nodes that are processed on it.
+             */
+            class OfflineNodeManager
+            {
+            public:
+                /**
+                 * Constructor
+                 * @param bufferSize Internal buffer size of the node manager.
+                 * @param sampleRate Sample rate of the node manager.
+                 */
+                OfflineNodeManager(int bufferSize, float sampleRate = 48000.f) : mNodeManager(mDeletionQueue), mBufferSize(bufferSize)
+                {
+                    mNodeManager.setInputChannelCount(0);
+                    mNodeManager.setOutputChannelCount(0);
+                    mNodeManager.setSampleRate(sampleRate);
+                    mNodeManager.setInternalBufferSize(bufferSize);
+                    mSink = mNodeManager.makeSafe<Sink>(mNodeManager);
+                    mNodeManager.registerRootProcess(*mSink);
+                }
+
+                ~OfflineNodeManager()
+                {
+                    mNodeManager.unregisterRootProcess(*mSink);
+                    mSink = nullptr;
+                    mDeletionQueue.clear();
+                }
+
+                /**
+                 * @return The node manager to create nodes on.
+                 */
+                NodeManager& getNodeManager() { return mNodeManager; }
+
+                /**
+                 * Connects an output that will be pulled every buffer.
+                 */
+                void connect(OutputPin& output) { mSink->input.connect(output); }
+
+                /**
+                 * Processes one buffer. With NAP_AUDIO_RTCHECK real-time violations are also checked outside of the nodes.
+                 */
+                void process()
+                {
+#ifdef NAP_AUDIO_RTCHECK
+                    RealTimeChecker::Scope scope(nullptr);
+#endif
+                    mNodeManager.process(mInputBuffers, mOutputBuffers, mBufferSize);
+                }
+
+                /**
+                 * @return The buffer size.
+                 */
+                int getBufferSize() const { return mBufferSize; }
+
+            private:
+                DeletionQueue mDeletionQueue;
+                NodeManager mNodeManager;
+                int mBufferSize = 0;
+                SafeOwner<Sink> mSink = nullptr;
+                std::vector<SampleBuffer*> mInputBuffers;
+                std::vector<SampleBuffer*> mOutputBuffers;
+            };
+
+        }
+
+    }
+
+}
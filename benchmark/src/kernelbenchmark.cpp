@@ -0,0 +1,398 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+/**
+ * Measures the processing time per sample of the DSP kernels and nodes in the module.
+ * Runs headless on a standalone node manager and prints one JSON object per line:
+ *     napaudioadvanced_kernelbenchmark [bufferSize...]
+ */
+
+#include "benchmark.h"
+
+// Audio includes
+#include <audio/utility/allpass.h>
+#include <audio/utility/comb.h>
+#include <audio/utility/vectordelay.h>
+#include <audio/utility/biquad.h>
+#include <audio/utility/karplusstrong.h>
+#include <audio/utility/karplusstrongbank.h>
+#include <audio/utility/onepole.h>
+#include <audio/utility/multitapreader.h>
+#include <audio/utility/grainpool.h>
+#include <audio/utility/noisegenerator.h>
+#include <audio/utility/vectorkernels.h>
+#include <audio/node/compressornode.h>
+#include <audio/node/reverbnode47.h>
+#include <audio/node/oscillatornode.h>
+#include <audio/node/envelopenode.h>
+#include <audio/node/filterbanknode.h>
+#include <audio/node/fusedchainnode.h>
+#include <audio/node/multiplynode.h>
+#include <audio/node/onepolenode.h>
+
+using namespace nap;
+using namespace nap::audio;
+using namespace nap::audio::benchmark;
+
+namespace
+{
+    // Accumulates results so the compiler can not optimize the processing away.
+    volatile float resultSink = 0.f;
+
+
+    float sumVector(const float4& value)
+    {
+        float result = 0.f;
+        for (auto i = 0; i < 4; ++i)
+            result += value[i];
+        return result;
+    }
+
+
+    float sumVector(const float8& value)
+    {
+        float result = 0.f;
+        for (auto i = 0; i < 8; ++i)
+            result += value[i];
+        return result;
+    }
+
+
+    float sumVector(const float16& value)
+    {
+        float result = 0.f;
+        for (auto i = 0; i < 16; ++i)
+            result += value[i];
+        return result;
+    }
+
+
+    float sumVector(float value)
+    {
+        return value;
+    }
+
+
+    // Measures a kernel with a process(real) -> real method for one block of samples per call.
+    template <typename real, typename Kernel>
+    void runKernel(const std::string& name, Kernel& kernel, const SampleBuffer& input)
+    {
+        int size = input.size();
+        auto result = measure(size, [&]() {
+            real accumulator = real(0.f);
+            for (auto i = 0; i < size; ++i)
+                accumulator = accumulator + kernel.process(real(input[i]));
+            resultSink = resultSink + sumVector(accumulator);
+        });
+        printResult(name, size, result);
+    }
+
+
+    template <typename real>
+    void runBiquad(const std::string& name, const SampleBuffer& input)
+    {
+        BiquadFilter<real> filter;
+        filter.setCoefficients(real(0.2f), real(0.f), real(-0.2f), real(-1.6f), real(0.7f), real(1.f));
+        runKernel<real>(name, filter, input);
+    }
+
+
+    void runKernels(const SampleBuffer& input)
+    {
+        AllPass allPass(2048);
+        allPass.setDelay(1031);
+        allPass.setGain(0.5f);
+        runKernel<float>("AllPass", allPass, input);
+
+        Comb comb;
+        comb.reset(2048);
+        comb.setDelay(1163);
+        comb.setGain(0.7f);
+        comb.setFeedforward(0.5f);
+        runKernel<float>("Comb", comb, input);
+
+        VectorDelay<float> delay(4096);
+        int size = input.size();
+        printResult("VectorDelay", size, measure(size, [&]() {
+            float accumulator = 0.f;
+            for (auto i = 0; i < size; ++i)
+            {
+                delay.write(input[i]);
+                accumulator += delay.readInterpolating(1000.5f);
+            }
+            resultSink = resultSink + accumulator;
+        }));
+
+        runBiquad<float>("BiquadFilter<float>", input);
+        runBiquad<float4>("BiquadFilter<float4>", input);
+        runBiquad<float8>("BiquadFilter<float8>", input);
+        runBiquad<float16>("BiquadFilter<float16>", input);
+
+        KarplusStrong<float> karplusStrong;
+        karplusStrong.reset(4096);
+        karplusStrong.setDelayTime(109.f, 1);
+        karplusStrong.setFeedback(0.95f);
+        karplusStrong.setDamping(5000.f, 48000.f);
+        printResult("KarplusStrong", size, measure(size, [&]() {
+            float accumulator = 0.f;
+            for (auto i = 0; i < size; ++i)
+                accumulator += karplusStrong.processPositive(input[i]);
+            resultSink = resultSink + accumulator;
+        }));
+
+        // 64 strings as separate scalar strings and as one bank
+        std::vector<KarplusStrong<float>> strings(64);
+        for (auto string = 0; string < strings.size(); ++string)
+        {
+            strings[string].reset(4096);
+            strings[string].setDelayTime(50.f + string * 7.f, 1);
+            strings[string].setFeedback(0.95f);
+            strings[string].setDamping(5000.f, 48000.f);
+        }
+        printResult("KarplusStrong<float> x 64", size, measure(size, [&]() {
+            float accumulator = 0.f;
+            for (auto& string : strings)
+                for (auto i = 0; i < size; ++i)
+                    accumulator += string.processPositive(input[i]);
+            resultSink = resultSink + accumulator;
+        }));
+
+        // The same 64 strings in four float16 strings with a delay time per lane
+        std::vector<KarplusStrong<float16>> vectorStrings(4);
+        for (auto group = 0; group < vectorStrings.size(); ++group)
+        {
+            float16 delayTime;
+            for (auto lane = 0; lane < 16; ++lane)
+                delayTime[lane] = 50.f + (group * 16 + lane) * 7.f;
+            vectorStrings[group].reset(4096);
+            vectorStrings[group].setDelayTime(delayTime, 1);
+            vectorStrings[group].setFeedback(float16(0.95f));
+            vectorStrings[group].setDamping(5000.f, 48000.f);
+        }
+        printResult("KarplusStrong<float16> x 4", size, measure(size, [&]() {
+            float16 accumulator(0.f);
+            for (auto& string : vectorStrings)
+                for (auto i = 0; i < size; ++i)
+                    accumulator = accumulator + string.processPositive(float16(input[i]));
+            resultSink = resultSink + sumVector(accumulator);
+        }));
+
+        KarplusStrongBank stringBank(64, 4096);
+        for (auto string = 0; string < stringBank.getStringCount(); ++string)
+        {
+            stringBank.setDelayTime(string, 50.f + string * 7.f);
+            stringBank.setFeedback(string, 0.95f);
+            stringBank.setDamping(string, 5000.f, 48000.f);
+        }
+        SampleBuffer stringBankOutput(size);
+        printResult("KarplusStrongBank<64 strings>", size, measure(size, [&]() {
+            stringBank.process(input.data(), stringBankOutput.data(), size);
+            resultSink = resultSink + stringBankOutput[0];
+        }));
+
+        OnePoleLowPass<float> lowPass;
+        lowPass.setCutoffFrequency(1000.f, 48000.f);
+        runKernel<float>("OnePoleLowPass", lowPass, input);
+
+        OnePoleHighPass<float> highPass;
+        highPass.setCutoffFrequency(1000.f, 48000.f);
+        runKernel<float>("OnePoleHighPass", highPass, input);
+
+        FaustCompressor compressor(48000);
+        compressor.setThreshold(-20.f);
+        SampleBuffer compressorInput = input;
+        SampleBuffer compressorOutput(size);
+        printResult("FaustCompressor", size, measure(size, [&]() {
+            compressor.compute(size, compressorInput.data(), compressorOutput.data());
+            resultSink = resultSink + compressorOutput[0];
+        }));
+
+        SampleBuffer tapSource = createNoise(65536);
+        SampleBuffer tapOutput(size);
+        const char* interpolationNames[] = { "Linear", "Hermite", "Sinc" };
+        for (auto interpolation : { TapInterpolation::Linear, TapInterpolation::Hermite, TapInterpolation::Sinc })
+        {
+            MultiTapReader reader(32);
+            reader.setTapCount(32);
+            for (auto tap = 0; tap < 32; ++tap)
+            {
+                reader.setPosition(tap, 1000.0 + tap * 997.3, tapSource.size());
+                reader.setSpeed(tap, 0.5f + tap * 0.03f);
+                reader.setGain(tap, 1.f / 32);
+            }
+            printResult(std::string("MultiTapReader<32 taps, ") + interpolationNames[int(interpolation)] + ">", size, measure(size, [&]() {
+                reader.process(tapSource.data(), tapSource.size(), tapOutput.data(), size, interpolation);
+                resultSink = resultSink + tapOutput[0];
+            }));
+        }
+
+        // 128 overlapping grains of 50ms, which amounts to 2560 grains per second
+        GrainPool grainPool(128);
+        auto nextGrain = 0;
+        printResult("GrainPool<128 grains>", size, measure(size, [&]() {
+            while (grainPool.getGrainCount() < grainPool.getMaxGrainCount())
+            {
+                grainPool.start(1000.0 + (nextGrain * 997) % 50000, 0.5f + (nextGrain % 32) * 0.03f, 1.f / 32, 2400, nextGrain % size);
+                nextGrain++;
+            }
+            grainPool.process(tapSource.data(), tapSource.size(), true, tapOutput.data(), size, GrainWindow::Hann);
+            resultSink = resultSink + tapOutput[0];
+        }));
+
+        NoiseGenerator noise(1);
+        SampleBuffer noiseOutput(size);
+        const char* colorNames[] = { "White", "Pink", "Brown" };
+        for (auto color : { NoiseColor::White, NoiseColor::Pink, NoiseColor::Brown })
+            printResult(std::string("NoiseGenerator<") + colorNames[int(color)] + ">", size, measure(size, [&]() {
+                noise.process(noiseOutput.data(), size, color);
+                resultSink = resultSink + noiseOutput[0];
+            }));
+
+        FilterBank filterBank;
+        filterBank.setFilterCount(8);
+        filterBank.setParameters({ 100.f, 200.f, 400.f, 800.f, 1600.f, 3200.f, 6400.f, 12800.f }, { 50.f }, { 1.f }, 48000.f);
+        SampleBuffer filterBankInput = input;
+        SampleBuffer filterBankOutput(size);
+        printResult("FilterBank", size, measure(size, [&]() {
+            filterBank.processBuffer(filterBankInput, filterBankOutput);
+            resultSink = resultSink + filterBankOutput[0];
+        }));
+
+        // The dispatched kernels on every instruction set that this machine supports
+        for (auto instructionSet : { InstructionSet::Baseline, InstructionSet::AVX2, InstructionSet::AVX512 })
+        {
+            auto kernels = getVectorKernels(instructionSet);
+            if (kernels == nullptr)
+                continue;
+            std::string suffix = std::string("<") + getInstructionSetName(instructionSet) + ">";
+
+            SampleBuffer mixOutput(size, 0.f);
+            printResult("VectorKernels::mix" + suffix, size, measure(size, [&]() {
+                kernels->mix(mixOutput.data(), input.data(), 0.5f, size);
+                resultSink = resultSink + mixOutput[0];
+            }));
+
+            BiquadBankState biquadBank;
+            float coefficients[BiquadBankState::coefficientCount][BiquadBankState::laneCount];
+            const float values[BiquadBankState::coefficientCount] = { 0.2f, 0.f, -0.2f, -1.6f, 0.7f, 1.f };
+            for (auto coefficient = 0; coefficient < BiquadBankState::coefficientCount; ++coefficient)
+                for (auto lane = 0; lane < BiquadBankState::laneCount; ++lane)
+                    coefficients[coefficient][lane] = values[coefficient];
+            biquadBank.setCoefficients(coefficients);
+            printResult("VectorKernels::processBiquadBank" + suffix, size, measure(size, [&]() {
+                kernels->processBiquadBank(biquadBank, input.data(), filterBankOutput.data(), size, BiquadBankState::laneCount);
+                resultSink = resultSink + filterBankOutput[0];
+            }));
+
+            std::vector<double> positions(32);
+            std::vector<float> speeds(32);
+            std::vector<float> gains(32, 1.f / 32);
+            for (auto tap = 0; tap < 32; ++tap)
+            {
+                positions[tap] = 1000.0 + tap * 997.3;
+                speeds[tap] = 0.5f + tap * 0.03f;
+            }
+            TapReadContext context;
+            context.mSource = tapSource.data();
+            context.mMask = tapSource.size() - 1;
+            context.mPositions = positions.data();
+            context.mSpeeds = speeds.data();
+            context.mGains = gains.data();
+            context.mTapCount = 32;
+            printResult("VectorKernels::readTapsHermite<32 taps>" + suffix, size, measure(size, [&]() {
+                kernels->readTapsHermite(context, tapOutput.data(), size);
+                resultSink = resultSink + tapOutput[0];
+            }));
+        }
+    }
+
+
+    // Measures a node by processing a standalone node manager that pulls its output.
+    void runNode(const std::string& name, OfflineNodeManager& offline, OutputPin& output)
+    {
+        offline.connect(output);
+        printResult(name, offline.getBufferSize(), measure(offline.getBufferSize(), [&]() { offline.process(); }));
+    }
+
+
+    void runNodes(const SampleBuffer& input)
+    {
+        int size = input.size();
+
+        {
+            OfflineNodeManager offline(size);
+            auto& nodeManager = offline.getNodeManager();
+            auto source = nodeManager.makeSafe<SignalSource>(nodeManager, input);
+            runNode("SignalSource", offline, source->output);
+        }
+
+        {
+            OfflineNodeManager offline(size);
+            auto& nodeManager = offline.getNodeManager();
+            auto source = nodeManager.makeSafe<SignalSource>(nodeManager, input);
+            auto reverb = nodeManager.makeSafe<verb47::ReverbNode>(nodeManager);
+            reverb->audioInput.connect(source->output);
+            runNode("ReverbNode", offline, reverb->audioOutput);
+        }
+
+        {
+            OfflineNodeManager offline(size);
+            auto& nodeManager = offline.getNodeManager();
+            auto wave = nodeManager.makeSafe<WaveTable>(2048, WaveTable::Waveform::Saw, 100);
+            auto oscillator = nodeManager.makeSafe<OscillatorNode>(nodeManager, wave);
+            oscillator->setFrequency(440.f);
+            runNode("OscillatorNode", offline, oscillator->output);
+        }
+
+        {
+            OfflineNodeManager offline(size);
+            auto& nodeManager = offline.getNodeManager();
+            EnvelopeNode::Envelope envelope(1);
+            envelope[0].mDuration = 1e9f; // Keep ramping during the whole measurement
+            envelope[0].mDestination = 1.f;
+            auto envelopeNode = nodeManager.makeSafe<EnvelopeNode>(nodeManager, envelope, nullptr);
+            envelopeNode->trigger();
+            runNode("EnvelopeNode", offline, envelopeNode->output);
+        }
+
+        // Lowpass, gain and envelope multiply as separate nodes and fused into one node
+        {
+            OfflineNodeManager offline(size);
+            auto& nodeManager = offline.getNodeManager();
+            auto source = nodeManager.makeSafe<SignalSource>(nodeManager, input);
+            auto envelope = nodeManager.makeSafe<SignalSource>(nodeManager, input);
+            auto filter = nodeManager.makeSafe<OnePoleLowPassNode>(nodeManager);
+            auto multiply = nodeManager.makeSafe<MultiplyNode>(nodeManager);
+            filter->setCutoffFrequency(1000.f);
+            filter->input.connect(source->output);
+            multiply->inputs.connect(filter->output);
+            multiply->inputs.connect(envelope->output);
+            runNode("OnePoleLowPassNode+MultiplyNode", offline, multiply->audioOutput);
+        }
+
+        {
+            OfflineNodeManager offline(size);
+            auto& nodeManager = offline.getNodeManager();
+            auto source = nodeManager.makeSafe<SignalSource>(nodeManager, input);
+            auto envelope = nodeManager.makeSafe<SignalSource>(nodeManager, input);
+            auto chain = nodeManager.makeSafe<LowPassGainNode>(nodeManager);
+            chain->update<0>([](OnePoleLowPassKernel& kernel){ kernel.setCutoffFrequency(1000.f); });
+            chain->audioInput.connect(source->output);
+            chain->gainInput.connect(envelope->output);
+            runNode("LowPassGainNode", offline, chain->audioOutput);
+        }
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    for (auto bufferSize : getBufferSizes(argc, argv))
+    {
+        auto input = createNoise(bufferSize);
+        runKernels(input);
+        runNodes(input);
+    }
+    return 0;
+}
@@ -0,0 +1,539 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+/**
+ * Measures how polyphonic playback scales with the number of voices.
+ * Scripted note patterns are played on a Polyphonic, a SamplePlayerInstance and a SampleLayerController that are processed on a standalone node manager.
+ * For every scenario the callback time percentiles, the voice allocation latency and the number of callbacks that exceeded their real-time budget are printed as one JSON object per line:
+ *     napaudioadvanced_voicebenchmark [--voice fm|sine] [--buffer size]... [--voices count]...
+ */
+
+#include "benchmark.h"
+
+// Std includes
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <set>
+
+// Nap includes
+#include <mathutils.h>
+
+// Audio includes
+#include <audio/core/polyphonic.h>
+#include <audio/object/oscillator.h>
+#include <audio/object/envelope.h>
+#include <audio/object/multiply.h>
+#include <audio/object/control.h>
+#include <audio/object/filter.h>
+#include <audio/object/sampler.h>
+#include <audio/resource/equalpowertable.h>
+#include <audio/resource/audiobufferresource.h>
+#include <audio/utility/samplelayercontroller.h>
+#include <audio/utility/realtimecheckerhooks.h>
+
+using namespace nap;
+using namespace nap::audio;
+using namespace nap::audio::benchmark;
+
+namespace
+{
+    constexpr float sampleRate = 48000.f;
+    constexpr TimeValue scenarioDuration = 10000.f; // Duration of the audio rendered per scenario in ms
+    constexpr TimeValue release = 50.f;
+
+
+    /**
+     * A note in a scripted pattern.
+     */
+    struct NoteEvent
+    {
+        TimeValue mTime = 0.f;      // Start time in ms
+        TimeValue mDuration = 0.f;  // Time in ms after which the note is stopped
+        int mPitch = 60;            // Midi note number
+    };
+
+
+    // Chords of four notes every half second, held for 400ms.
+    std::vector<NoteEvent> createChordPattern(int voiceCount)
+    {
+        std::vector<NoteEvent> result;
+        int chord[] = { 0, 4, 7, 11 };
+        for (TimeValue time = 0.f; time < scenarioDuration; time += 500.f)
+            for (auto interval : chord)
+                result.push_back({ time, 400.f, 48 + interval });
+        return result;
+    }
+
+
+    // A fast arpeggio with one note every 25ms that overlap each other.
+    std::vector<NoteEvent> createArpeggioPattern(int voiceCount)
+    {
+        std::vector<NoteEvent> result;
+        int step = 0;
+        for (TimeValue time = 0.f; time < scenarioDuration; time += 25.f)
+            result.push_back({ time, 150.f, 60 + (step++ * 7) % 24 });
+        return result;
+    }
+
+
+    // Every second twice as many notes as there are voices are started at once, to exercise voice stealing and failed allocations.
+    std::vector<NoteEvent> createBurstPattern(int voiceCount)
+    {
+        std::vector<NoteEvent> result;
+        for (TimeValue time = 0.f; time < scenarioDuration; time += 1000.f)
+            for (auto i = 0; i < 2 * voiceCount; ++i)
+                result.push_back({ time, 800.f, 36 + i % 48 });
+        return result;
+    }
+
+
+    struct Pattern
+    {
+        const char* mName;
+        std::vector<NoteEvent> (*mCreate)(int voiceCount);
+    };
+
+    const Pattern patterns[] = {
+        { "chords", &createChordPattern },
+        { "arpeggio", &createArpeggioPattern },
+        { "burst", &createBurstPattern }
+    };
+
+
+    /**
+     * Plays a pattern on an offline node manager and collects the statistics of the scenario.
+     */
+    class ScenarioRunner
+    {
+    public:
+        ScenarioRunner(OfflineNodeManager& offline) : mOffline(offline) { }
+
+        /**
+         * Calls a function that allocates one or more voices and records the time it took.
+         */
+        template <typename Function>
+        void measureAllocation(Function&& function)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            mAllocationTimes.emplace_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        /**
+         * Calls a function that allocates a voice, records the time it took and counts failed allocations.
+         */
+        template <typename Function>
+        VoiceInstance* allocate(Function&& function)
+        {
+            VoiceInstance* voice = nullptr;
+            measureAllocation([&]() { voice = function(); });
+            if (voice == nullptr)
+                mFailedAllocations++;
+            return voice;
+        }
+
+        /**
+         * Renders the duration of the scenario while starting and stopping the notes of the pattern.
+         * @param pattern Notes sorted by start time.
+         * @param play Starts a note and returns the voice playing it or nullptr. Has to use allocate() or measureAllocation() to acquire voices.
+         * @param stop Stops a voice.
+         * @param getBusyVoiceCount Returns the number of busy voices.
+         */
+        template <typename Play, typename Stop, typename BusyVoiceCount>
+        void run(const std::vector<NoteEvent>& pattern, Play&& play, Stop&& stop, BusyVoiceCount&& getBusyVoiceCount)
+        {
+            int bufferSize = mOffline.getBufferSize();
+            TimeValue blockDuration = 1000.f * bufferSize / sampleRate;
+            double budget = 1e9 * bufferSize / sampleRate;
+            int blockCount = int(scenarioDuration / blockDuration);
+            mCallbackTimes.reserve(blockCount);
+
+            // Voices that are playing with the time at which they will be stopped
+            std::vector<std::pair<TimeValue, VoiceInstance*>> playing;
+            auto next = pattern.begin();
+
+            for (auto block = 0; block < blockCount; ++block)
+            {
+                TimeValue now = block * blockDuration;
+
+                for (auto it = playing.begin(); it != playing.end();)
+                {
+                    if (it->first <= now)
+                    {
+                        stop(it->second);
+                        it = playing.erase(it);
+                    }
+                    else
+                        ++it;
+                }
+
+                for (; next != pattern.end() && next->mTime <= now; ++next)
+                {
+                    auto voice = play(*next);
+                    if (voice == nullptr)
+                        continue;
+
+                    // A stolen voice is stopped at the end of the new note only
+                    playing.erase(std::remove_if(playing.begin(), playing.end(), [voice](const std::pair<TimeValue, VoiceInstance*>& entry) { return entry.second == voice; }), playing.end());
+                    playing.emplace_back(now + next->mDuration, voice);
+                }
+
+                auto start = std::chrono::steady_clock::now();
+                mOffline.process();
+                auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+                mCallbackTimes.emplace_back(elapsed / 1000.0);
+                if (elapsed > budget)
+                    mGlitchCount++;
+
+                mMaximumBusyVoiceCount = std::max(mMaximumBusyVoiceCount, getBusyVoiceCount());
+            }
+        }
+
+        /**
+         * Prints the statistics of the scenario as a single line JSON object.
+         */
+        void print(const std::string& name, int voiceCount)
+        {
+            std::cout << "{\"benchmark\": \"" << name << "\", \"backend\": \"" << getBackendName() << "\", \"bufferSize\": " << mOffline.getBufferSize() << ", \"voices\": " << voiceCount;
+            std::cout << ", \"callbackUs\": ";
+            printPercentiles(getPercentiles(mCallbackTimes));
+            std::cout << ", \"allocationNs\": ";
+            printPercentiles(getPercentiles(mAllocationTimes));
+            std::cout << ", \"glitches\": " << mGlitchCount << ", \"callbacks\": " << mCallbackTimes.size() << ", \"failedAllocations\": " << mFailedAllocations << ", \"maxBusyVoices\": " << mMaximumBusyVoiceCount;
+            if (RealTimeChecker::isEnabled())
+                std::cout << ", \"realTimeViolations\": " << RealTimeChecker::get().logViolations();
+            std::cout << "}" << std::endl;
+        }
+
+    private:
+        OfflineNodeManager& mOffline;
+        std::vector<double> mCallbackTimes;     // In microseconds
+        std::vector<double> mAllocationTimes;   // In nanoseconds
+        int mGlitchCount = 0;
+        int mFailedAllocations = 0;
+        int mMaximumBusyVoiceCount = 0;
+    };
+
+
+    /**
+     * Owns the resources of a voice graph that is created in code.
+     */
+    class VoicePatch
+    {
+    public:
+        template <typename T, typename... Args>
+        T& add(const std::string& id, Args&&... args)
+        {
+            auto resource = std::make_unique<T>(std::forward<Args>(args)...);
+            resource->mID = id;
+            auto& result = *resource;
+            mResources.emplace_back(std::move(resource));
+            return result;
+        }
+
+        bool init(utility::ErrorState& errorState)
+        {
+            for (auto& resource : mResources)
+                if (!resource->init(errorState))
+                    return false;
+            return true;
+        }
+
+        Voice* mVoice = nullptr;
+
+    private:
+        std::vector<std::unique_ptr<Resource>> mResources; // In order of initialization
+    };
+
+
+    // Creates the voice of the fmsynth demo: an oscillator frequency modulated by a second oscillator, filtered and multiplied with an envelope and a gain.
+    bool createFmVoice(VoicePatch& patch, NodeManager& nodeManager, utility::ErrorState& errorState)
+    {
+        auto& equalPowerTable = patch.add<EqualPowerTable>("EqualPowerTable", nodeManager);
+        auto& sine = patch.add<WaveTableResource>("SineWaveform", nodeManager);
+        sine.mWaveform = WaveTable::Waveform::Sine;
+        auto& saw = patch.add<WaveTableResource>("SawWaveform", nodeManager);
+        saw.mWaveform = WaveTable::Waveform::Saw;
+
+        auto& modulator = patch.add<Oscillator>("ModulatorOscillator");
+        modulator.mFrequency = { 220.f };
+        modulator.mWaveTables = { &sine };
+
+        auto& carrier = patch.add<Oscillator>("CarrierOscillator");
+        carrier.mFrequency = { 220.f };
+        carrier.mFmInput = &modulator;
+        carrier.mWaveTables = { &sine, &saw };
+        carrier.mWaveTableSelection = 1;
+
+        auto& filter = patch.add<Filter>("Filter");
+        filter.mInput = &carrier;
+        filter.mMode = FilterNode::EMode::LowRes;
+        filter.mGain = { 0.1f };
+
+        auto& envelope = patch.add<Envelope>("Envelope");
+        envelope.mSegments.resize(3);
+        envelope.mSegments[0].mDuration = 10.f;
+        envelope.mSegments[0].mDestination = 1.f;
+        envelope.mSegments[1].mDuration = 200.f;
+        envelope.mSegments[1].mDestination = 0.5f;
+        envelope.mSegments[1].mTranslate = true;
+        envelope.mSegments[2].mDuration = 50.f;
+        envelope.mSegments[2].mMode = RampMode::Exponential;
+        envelope.mEqualPowerTable = &equalPowerTable;
+
+        auto& gain = patch.add<Control>("Gain");
+        gain.mValue = 0.01f;
+        gain.mEqualPowerTable = &equalPowerTable;
+
+        auto& multiply = patch.add<Multiply>("Multiply");
+        multiply.mInputs = { &filter, &envelope, &gain };
+
+        auto& voice = patch.add<Voice>("SynthVoice");
+        voice.mObjects = { &modulator, &carrier, &filter, &envelope, &gain, &multiply };
+        voice.mEnvelope = &envelope;
+        voice.mOutput = &multiply;
+        patch.mVoice = &voice;
+
+        return patch.init(errorState);
+    }
+
+
+    // Creates the cheapest possible voice: a sine oscillator multiplied with an envelope.
+    bool createSineVoice(VoicePatch& patch, NodeManager& nodeManager, utility::ErrorState& errorState)
+    {
+        auto& sine = patch.add<WaveTableResource>("SineWaveform", nodeManager);
+
+        auto& oscillator = patch.add<Oscillator>("CarrierOscillator");
+        oscillator.mWaveTables = { &sine };
+
+        auto& envelope = patch.add<Envelope>("Envelope");
+        envelope.mSegments.resize(2);
+        envelope.mSegments[0].mDuration = 10.f;
+        envelope.mSegments[0].mDestination = 1.f;
+        envelope.mSegments[1].mDuration = 250.f;
+
+        auto& multiply = patch.add<Multiply>("Multiply");
+        multiply.mInputs = { &oscillator, &envelope };
+
+        auto& voice = patch.add<Voice>("SineVoice");
+        voice.mObjects = { &oscillator, &envelope, &multiply };
+        voice.mEnvelope = &envelope;
+        voice.mOutput = &multiply;
+        patch.mVoice = &voice;
+
+        return patch.init(errorState);
+    }
+
+
+    /**
+     * Buffer resource containing a generated decaying tone, so the sampler can be measured without audio files.
+     */
+    class GeneratedBufferResource : public AudioBufferResource
+    {
+    public:
+        GeneratedBufferResource(NodeManager& nodeManager, TimeValue duration) : AudioBufferResource()
+        {
+            int size = int(duration * sampleRate / 1000.f);
+            auto buffer = nodeManager.makeSafe<MultiSampleBuffer>(1, size);
+            auto& channel = (*buffer)[0];
+            for (auto i = 0; i < size; ++i)
+                channel[i] = std::sin(math::PIX2 * 220.f * i / sampleRate) * std::exp(-float(i) / size);
+            setBuffer(std::move(buffer));
+            setSampleRate(sampleRate);
+        }
+    };
+
+
+    float toFrequency(int pitch)
+    {
+        return 440.f * std::pow(2.f, (pitch - 69) / 12.f);
+    }
+
+
+    bool runPolyphonic(const std::string& voiceName, int bufferSize, int voiceCount, utility::ErrorState& errorState)
+    {
+        for (auto& pattern : patterns)
+        {
+            OfflineNodeManager offline(bufferSize, sampleRate);
+            auto& nodeManager = offline.getNodeManager();
+
+            VoicePatch patch;
+            if (!(voiceName == "sine" ? createSineVoice(patch, nodeManager, errorState) : createFmVoice(patch, nodeManager, errorState)))
+                return false;
+
+            PolyphonicInstance polyphonic;
+            if (!polyphonic.init(*patch.mVoice, voiceCount, true, 1, nodeManager, errorState))
+                return false;
+            offline.connect(*polyphonic.getOutputForChannel(0));
+
+            PolyphonicInstance::ObjectMap<OscillatorInstance> oscillators;
+            if (!polyphonic.getObjectMap("CarrierOscillator", oscillators, errorState))
+                return false;
+
+            ScenarioRunner runner(offline);
+            runner.run(pattern.mCreate(voiceCount), [&](const NoteEvent& note) {
+                auto voice = runner.allocate([&]() { return polyphonic.findFreeVoice(); });
+                if (voice != nullptr)
+                {
+                    oscillators[voice]->getChannel(0)->setFrequency(toFrequency(note.mPitch));
+                    polyphonic.play(voice);
+                }
+                return voice;
+            }, [&](VoiceInstance* voice) {
+                polyphonic.stop(voice, release);
+            }, [&]() {
+                return polyphonic.getBusyVoiceCount();
+            });
+            runner.print("Polyphonic/" + voiceName + "/" + pattern.mName, voiceCount);
+
+            // Disconnect the voices before the node manager is destroyed
+            polyphonic.reset();
+        }
+        return true;
+    }
+
+
+    // Sampler entries that loop different sections of a generated buffer.
+    SamplePlayer::SamplerEntries createSamplerEntries(GeneratedBufferResource& buffer, int count)
+    {
+        SamplePlayer::SamplerEntries result(count);
+        for (auto i = 0; i < count; ++i)
+        {
+            auto& entry = result[i];
+            entry.mBufferResource = &buffer;
+            entry.mStart = 10.f * i;
+            entry.mLoopStart = 100.f + 10.f * i;
+            entry.mLoopEnd = 900.f;
+            entry.mCrossFadeTime = 50.f;
+            entry.mTranspose = float(i % 12);
+        }
+        return result;
+    }
+
+
+    bool runSampler(int bufferSize, int voiceCount, utility::ErrorState& errorState)
+    {
+        const int entryCount = 8;
+
+        for (auto& pattern : patterns)
+        {
+            OfflineNodeManager offline(bufferSize, sampleRate);
+            auto& nodeManager = offline.getNodeManager();
+
+            EqualPowerTable equalPowerTable(nodeManager);
+            GeneratedBufferResource buffer(nodeManager, 1000.f);
+            if (!equalPowerTable.init(errorState) || !buffer.init(errorState))
+                return false;
+
+            auto entries = createSamplerEntries(buffer, entryCount);
+            EnvelopeNode::Envelope envelope(3);
+            envelope[0].mDuration = 10.f;
+            envelope[0].mDestination = 1.f;
+            envelope[1].mDurationRelative = true;
+            envelope[1].mDestination = 1.f;
+            envelope[2].mDuration = release;
+
+            SamplePlayerInstance sampler;
+            if (!sampler.init(entries, &equalPowerTable, envelope, 1, voiceCount, nodeManager, errorState))
+                return false;
+            offline.connect(*sampler.getOutputForChannel(0));
+
+            // The sampler does not expose its voices, so count the notes that have been started and not stopped yet
+            int busyVoiceCount = 0;
+            ScenarioRunner runner(offline);
+            runner.run(pattern.mCreate(voiceCount), [&](const NoteEvent& note) {
+                auto voice = runner.allocate([&]() { return sampler.play(note.mPitch % entryCount, note.mDuration + release); });
+                if (voice != nullptr)
+                    busyVoiceCount++;
+                return voice;
+            }, [&](VoiceInstance* voice) {
+                sampler.stop(voice, release);
+                busyVoiceCount--;
+            }, [&]() {
+                return busyVoiceCount;
+            });
+            runner.print("SamplePlayer/" + std::string(pattern.mName), voiceCount);
+        }
+
+        // Layers that are crossfaded by the SampleLayerController every 250ms
+        {
+            OfflineNodeManager offline(bufferSize, sampleRate);
+            auto& nodeManager = offline.getNodeManager();
+
+            EqualPowerTable equalPowerTable(nodeManager);
+            GeneratedBufferResource buffer(nodeManager, 1000.f);
+            if (!equalPowerTable.init(errorState) || !buffer.init(errorState))
+                return false;
+
+            auto entries = createSamplerEntries(buffer, entryCount);
+            EnvelopeNode::Envelope envelope(1);
+
+            SamplePlayerInstance sampler;
+            if (!sampler.init(entries, &equalPowerTable, envelope, 1, voiceCount, nodeManager, errorState))
+                return false;
+            offline.connect(*sampler.getOutputForChannel(0));
+            SampleLayerController layers(sampler);
+
+            std::vector<NoteEvent> pattern;
+            for (TimeValue time = 0.f; time < scenarioDuration; time += 250.f)
+                pattern.push_back({ time, 250.f, int(pattern.size()) });
+
+            ScenarioRunner runner(offline);
+            runner.run(pattern, [&](const NoteEvent& note) {
+                // Replace the layers with a set of up to half the voices, rotating through the entries
+                std::set<int> selection;
+                for (auto i = 0; i < std::max(1, voiceCount / 2); ++i)
+                    selection.emplace((note.mPitch + i) % entryCount);
+                runner.measureAllocation([&]() { layers.replaceLayers(selection, 20.f, release); });
+                return static_cast<VoiceInstance*>(nullptr);
+            }, [&](VoiceInstance*) {
+            }, [&]() {
+                return int(layers.getLayers().size());
+            });
+            runner.print("SampleLayerController/crossfade", voiceCount);
+            layers.stopAllLayers(0.f);
+        }
+
+        return true;
+    }
+}
+
+
+// Report allocations of the whole executable on the audio thread when built with NAP_AUDIO_RTCHECK
+NAP_AUDIO_RTCHECK_ALLOCATION_HOOKS()
+
+
+int main(int argc, char** argv)
+{
+    std::string voiceName = "fm";
+    std::vector<int> bufferSizes;
+    std::vector<int> voiceCounts;
+    for (auto i = 1; i + 1 < argc; i += 2)
+    {
+        if (std::strcmp(argv[i], "--voice") == 0)
+            voiceName = argv[i + 1];
+        else if (std::strcmp(argv[i], "--buffer") == 0)
+            bufferSizes.emplace_back(std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--voices") == 0)
+            voiceCounts.emplace_back(std::atoi(argv[i + 1]));
+    }
+    if (bufferSizes.empty())
+        bufferSizes = { 64, 256 };
+    if (voiceCounts.empty())
+        voiceCounts = { 1, 8, 32, 128 };
+
+    utility::ErrorState errorState;
+    for (auto bufferSize : bufferSizes)
+        for (auto voiceCount : voiceCounts)
+        {
+            if (!runPolyphonic(voiceName, bufferSize, voiceCount, errorState) || !runSampler(bufferSize, voiceCount, errorState))
+            {
+                std::cerr << errorState.toString() << std::endl;
+                return 1;
+            }
+        }
+
+    return 0;
+}
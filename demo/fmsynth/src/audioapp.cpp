@@ -18,6 +18,10 @@
 #include <renderservice.h>
 #include <nap/logger.h>
 #include <parametersimple.h>
+#include <audio/utility/nodeprofiler.h>
+
+// Std includes
+#include <fstream>
 
 // Register this application with RTTI, this is required by the AppRunner to 
 // validate that this object is indeed an application
@@ -119,10 +123,42 @@ namespace nap
 		}
 		ImGui::NewLine();
 		ImGui::Text(utility::stringFormat("Framerate: %.02f", getCore().getFramerate()).c_str());
+#ifdef NAP_AUDIO_PROFILING
+        showProfiler();
+#endif
+#ifdef NAP_AUDIO_RTCHECK
+        audio::RealTimeChecker::get().logViolations();
+#endif
         ImGui::End();
     }
 
 	
+#ifdef NAP_AUDIO_PROFILING
+	void AudioTestApp::showProfiler()
+	{
+		if (!ImGui::CollapsingHeader("Audio profiler"))
+			return;
+
+		auto& profiler = audio::NodeProfiler::get();
+		for (auto& measurement : profiler.getObjectSnapshot())
+		{
+			auto name = measurement.mName.empty() ? std::string("(unnamed)") : measurement.mName;
+			ImGui::Text(utility::stringFormat("%-24s avg %8.2f us  max %8.2f us", name.c_str(), measurement.getAverageTime(), measurement.mMaxTime).c_str());
+		}
+
+		if (ImGui::Button("Reset"))
+			profiler.reset();
+		ImGui::SameLine();
+		if (ImGui::Button("Dump JSON"))
+		{
+			std::ofstream file("audioprofile.json");
+			file << profiler.toJSON();
+			nap::Logger::info("Audio profile written to audioprofile.json");
+		}
+	}
+#endif
+
+
 	void AudioTestApp::render()
 	{
 		// Signal the beginning of a new frame, allowing it to be recorded.
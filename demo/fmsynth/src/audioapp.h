@@ -81,6 +81,11 @@ namespace nap
 		int shutdown() override;
 
 	private:
+#ifdef NAP_AUDIO_PROFILING
+		// Shows the time spent per audio object, measured by the audio::NodeProfiler
+		void showProfiler();
+#endif
+
 		// Nap Services
 		RenderService* mRenderService = nullptr;						// Render Service that handles render calls
 		ResourceManager* mResourceManager = nullptr;					// Manages all the loaded resources
@@ -10,6 +10,12 @@
 #include <nap/logger.h>
 #include <apprunner.h>
 
+// Audio includes
+#include <audio/utility/realtimecheckerhooks.h>
+
+// Report allocations on the audio thread when built with NAP_AUDIO_RTCHECK
+NAP_AUDIO_RTCHECK_ALLOCATION_HOOKS()
+
 /**
  * Hello World Demo
  * refer to helloworldapp.h for a more detailed description of the application
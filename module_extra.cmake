@@ -8,6 +8,20 @@ if(NAP_BUILD_CONTEXT MATCHES "source")
         set(AUDIO_FILE_SUPPORT_FILTER ".*audiofile.*")
     endif()
 
+    # Per node cpu profiling, see NodeProfiler
+    option(NAP_AUDIO_PROFILING "Measure the time spent in the process() method of each node" OFF)
+    if (NAP_AUDIO_PROFILING)
+        target_compile_definitions(${PROJECT_NAME} PUBLIC NAP_AUDIO_PROFILING)
+    endif()
+
+    # Debug instrumentation that reports allocations and locks on the audio thread, see RealTimeChecker.
+    # Allocations are only reported through RealTimeCheckedAllocator, or when the executable expands
+    # NAP_AUDIO_RTCHECK_ALLOCATION_HOOKS() from audio/utility/realtimecheckerhooks.h in one of its source files.
+    option(NAP_AUDIO_RTCHECK "Report allocations, deallocations and locks within the process() method of nodes" OFF)
+    if (NAP_AUDIO_RTCHECK)
+        target_compile_definitions(${PROJECT_NAME} PUBLIC NAP_AUDIO_RTCHECK)
+    endif()
+
     add_source_dir("core" "src/audio/core")
     add_source_dir("node" "src/audio/node" ${AUDIO_FILE_SUPPORT_FILTER})
     add_source_dir("object" "src/audio/object" ${AUDIO_FILE_SUPPORT_FILTER})
@@ -15,4 +29,25 @@ if(NAP_BUILD_CONTEXT MATCHES "source")
     add_source_dir("service" "src/audio/service")
     add_source_dir("resource" "src/audio/resource" ${AUDIO_FILE_SUPPORT_FILTER})
     add_source_dir("utility" "src/audio/utility")
+
+    # The vector kernels are compiled once per instruction set and selected at runtime, see vectorkernels.h
+    if (CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|amd64|i.86")
+        set(VECTOR_KERNELS_DIR ${CMAKE_CURRENT_LIST_DIR}/src/audio/utility)
+        if (MSVC)
+            set_source_files_properties(${VECTOR_KERNELS_DIR}/vectorkernelsavx2.cpp PROPERTIES COMPILE_OPTIONS "/arch:AVX2")
+            set_source_files_properties(${VECTOR_KERNELS_DIR}/vectorkernelsavx512.cpp PROPERTIES COMPILE_OPTIONS "/arch:AVX512")
+        else()
+            set_source_files_properties(${VECTOR_KERNELS_DIR}/vectorkernelsavx2.cpp PROPERTIES COMPILE_OPTIONS "-mavx2;-mfma")
+            set_source_files_properties(${VECTOR_KERNELS_DIR}/vectorkernelsavx512.cpp PROPERTIES COMPILE_OPTIONS "-mavx2;-mfma;-mavx512f;-mavx512vl")
+        endif()
+    endif()
+
+    # Headless benchmarks that run on a standalone node manager, see benchmark/src
+    option(NAP_AUDIOADVANCED_BENCHMARKS "Build the napaudioadvanced benchmark executables" OFF)
+    if (NAP_AUDIOADVANCED_BENCHMARKS)
+        add_executable(napaudioadvanced_kernelbenchmark ${CMAKE_CURRENT_LIST_DIR}/benchmark/src/kernelbenchmark.cpp)
+        target_link_libraries(napaudioadvanced_kernelbenchmark ${PROJECT_NAME})
+        add_executable(napaudioadvanced_voicebenchmark ${CMAKE_CURRENT_LIST_DIR}/benchmark/src/voicebenchmark.cpp)
+        target_link_libraries(napaudioadvanced_voicebenchmark ${PROJECT_NAME})
+    endif()
 endif()
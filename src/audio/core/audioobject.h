@@ -21,6 +21,7 @@ namespace nap
         
         // Forward declarations
         class AudioObject;
+        class ControlRateOutputPin;
         
         
         /**
@@ -53,6 +54,13 @@ namespace nap
              * @return If multichannel input is implemented for this object it returns its input interface, otherwise nullptr.
              */
             IMultiChannelInput* getInput() { return dynamic_cast<IMultiChannelInput*>(this); }
+
+            /**
+             * Override this in objects that also output a control rate signal, so other objects can link to it, see @ControlRateOutputPin.
+             * @param channel The output channel.
+             * @return The control rate output of the channel, or nullptr if the object does not output a control rate signal.
+             */
+            virtual ControlRateOutputPin* getControlOutputForChannel(int channel) { return nullptr; }
             
             /**
              * @return If this object is instantiated from a resource this returns the mID of the resource.
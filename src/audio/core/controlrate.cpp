@@ -0,0 +1,123 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "controlrate.h"
+
+// Std includes
+#include <algorithm>
+#include <cassert>
+
+// Audio includes
+#include <audio/core/audionodemanager.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        void ControlRateBuffer::resize(int bufferSize, int interval)
+        {
+            assert(interval > 0);
+            mBufferSize = bufferSize;
+            mInterval = interval;
+            mValues.resize((bufferSize + interval - 1) / interval, mStartValue);
+        }
+
+
+        bool ControlRateBuffer::isConstant() const
+        {
+            for (auto& value : mValues)
+                if (value != mStartValue)
+                    return false;
+            return true;
+        }
+
+
+        void ControlRateBuffer::render(SampleValue* output) const
+        {
+            auto previous = mStartValue;
+            auto position = 0;
+            for (auto& value : mValues)
+            {
+                auto end = std::min(position + mInterval, mBufferSize);
+                auto increment = (value - previous) / (end - position);
+                for (auto i = position; i < end; ++i)
+                {
+                    previous += increment;
+                    output[i] = previous;
+                }
+                // Avoid accumulating rounding errors over the intervals.
+                output[end - 1] = value;
+                previous = value;
+                position = end;
+            }
+        }
+
+
+        ControlRateOutputPin::ControlRateOutputPin(Node* node, ControlRateSource* source, int interval) : mNode(node), mSource(source), mInterval(interval)
+        {
+            assert(interval > 0);
+        }
+
+
+        ControlRateOutputPin::~ControlRateOutputPin()
+        {
+            auto connection = mFirstConnection;
+            while (connection != nullptr)
+            {
+                auto next = connection->mNextConnection;
+                connection->mInput = nullptr;
+                connection->mNextConnection = nullptr;
+                connection = next;
+            }
+        }
+
+
+        const ControlRateBuffer* ControlRateOutputPin::pull()
+        {
+            auto sampleTime = mNode->getSampleTime();
+            if (sampleTime != mLastCalculatedSample)
+            {
+                mLastCalculatedSample = sampleTime;
+                if (!mBuffer.mValues.empty())
+                    mBuffer.mStartValue = mBuffer.mValues.back();
+                if (mBuffer.mBufferSize != mNode->getBufferSize())
+                    mBuffer.resize(mNode->getBufferSize(), mInterval);
+                mSource->processControlRate(mBuffer);
+            }
+            return &mBuffer;
+        }
+
+
+        ControlRateInputPin::~ControlRateInputPin()
+        {
+            disconnect();
+        }
+
+
+        void ControlRateInputPin::connect(ControlRateOutputPin& pin)
+        {
+            disconnect();
+            mInput = &pin;
+            mNextConnection = pin.mFirstConnection;
+            pin.mFirstConnection = this;
+        }
+
+
+        void ControlRateInputPin::disconnect()
+        {
+            if (mInput == nullptr)
+                return;
+            auto link = &mInput->mFirstConnection;
+            while (*link != this)
+                link = &(*link)->mNextConnection;
+            *link = mNextConnection;
+            mNextConnection = nullptr;
+            mInput = nullptr;
+        }
+
+    }
+
+}
@@ -0,0 +1,204 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/utility/audiotypes.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        // Forward declarations
+        class ControlRateInputPin;
+
+
+        /**
+         * Buffer containing a control rate signal for one buffer of the node manager.
+         * The signal is represented by one value per interval of samples. Each value is the exact value of the signal at the last sample of its interval.
+         * Consumers interpolate linearly between the values, starting from the last value of the previous buffer.
+         */
+        class NAPAPI ControlRateBuffer
+        {
+        public:
+            ControlRateBuffer() = default;
+
+            /**
+             * Resizes the buffer to hold a control rate representation of a buffer of the node manager.
+             * @param bufferSize Size of the audio rate buffer that is represented.
+             * @param interval Number of samples per control rate value. If the buffer size is not a multiple of the interval the last interval will be shorter.
+             */
+            void resize(int bufferSize, int interval);
+
+            /**
+             * @return Number of samples per control rate value.
+             */
+            int getInterval() const { return mInterval; }
+
+            /**
+             * @return Size of the audio rate buffer that is represented.
+             */
+            int getBufferSize() const { return mBufferSize; }
+
+            /**
+             * @return Number of control rate values in the buffer.
+             */
+            int getValueCount() const { return mValues.size(); }
+
+            /**
+             * @return The value at the end of the interval with the given index.
+             */
+            ControllerValue& operator[](int index) { return mValues[index]; }
+            const ControllerValue& operator[](int index) const { return mValues[index]; }
+
+            /**
+             * @return The last value of the previous buffer, the starting point of the interpolation.
+             */
+            ControllerValue getStartValue() const { return mStartValue; }
+
+            /**
+             * @return The last value of this buffer.
+             */
+            ControllerValue getEndValue() const { return mValues.back(); }
+
+            /**
+             * @return True if all values of the buffer, including the start value, are equal.
+             */
+            bool isConstant() const;
+
+            /**
+             * Renders the signal to audio rate by interpolating linearly between the values.
+             * @param output Pointer to getBufferSize() samples that will receive the result.
+             */
+            void render(SampleValue* output) const;
+
+        private:
+            friend class ControlRateOutputPin;
+
+            std::vector<ControllerValue> mValues;
+            ControllerValue mStartValue = 0.f;
+            int mInterval = 16;
+            int mBufferSize = 0;
+        };
+
+
+        /**
+         * Interface for a node that outputs a control rate signal on a ControlRateOutputPin.
+         */
+        class NAPAPI ControlRateSource
+        {
+        public:
+            virtual ~ControlRateSource() = default;
+
+        private:
+            friend class ControlRateOutputPin;
+
+            /**
+             * Calculates the control rate values of the current buffer. Called on the audio thread at most once per buffer.
+             * @param buffer The buffer that has to be filled with getValueCount() values.
+             */
+            virtual void processControlRate(ControlRateBuffer& buffer) = 0;
+        };
+
+
+        /**
+         * Output pin of a node that produces a control rate signal.
+         * A control rate signal contains one value per interval of samples instead of a value for each sample.
+         * This saves processing for modulation signals that change slowly, like envelopes and controls.
+         */
+        class NAPAPI ControlRateOutputPin
+        {
+        public:
+            /**
+             * Constructor
+             * @param node The node that owns the pin.
+             * @param source The object that calculates the control rate values, usually the owning node itself.
+             * @param interval Number of samples per control rate value.
+             */
+            ControlRateOutputPin(Node* node, ControlRateSource* source, int interval = 16);
+            ~ControlRateOutputPin();
+
+            ControlRateOutputPin(const ControlRateOutputPin&) = delete;
+            ControlRateOutputPin& operator=(const ControlRateOutputPin&) = delete;
+
+            /**
+             * Calculates the control rate values for the current buffer if this did not happen yet. Called on the audio thread.
+             * @return The buffer with control rate values.
+             */
+            const ControlRateBuffer* pull();
+
+            /**
+             * @return Number of samples per control rate value.
+             */
+            int getInterval() const { return mInterval; }
+
+            /**
+             * @return True if one or more input pins are connected to this output.
+             */
+            bool isConnected() const { return mFirstConnection != nullptr; }
+
+        private:
+            friend class ControlRateInputPin;
+
+            Node* mNode = nullptr;
+            ControlRateSource* mSource = nullptr;
+            int mInterval = 16;
+            ControlRateBuffer mBuffer;
+            DiscreteTimeValue mLastCalculatedSample = -1;
+            ControlRateInputPin* mFirstConnection = nullptr; // Connected inputs form a linked list through the input pins, so connecting does not allocate.
+        };
+
+
+        /**
+         * Input pin of a node that consumes a control rate signal.
+         * Connecting and disconnecting does not allocate and has to be performed on the audio thread, or before the node is being processed.
+         */
+        class NAPAPI ControlRateInputPin
+        {
+        public:
+            ControlRateInputPin() = default;
+            ~ControlRateInputPin();
+
+            ControlRateInputPin(const ControlRateInputPin&) = delete;
+            ControlRateInputPin& operator=(const ControlRateInputPin&) = delete;
+
+            /**
+             * Connects the pin to a control rate output, replacing the existing connection.
+             * @param pin The output pin to connect to.
+             */
+            void connect(ControlRateOutputPin& pin);
+
+            /**
+             * Disconnects the pin.
+             */
+            void disconnect();
+
+            /**
+             * @return True if the pin is connected to an output.
+             */
+            bool isConnected() const { return mInput != nullptr; }
+
+            /**
+             * Pulls the control rate values of the current buffer from the connected output. Called on the audio thread.
+             * @return The control rate buffer or nullptr if the pin is not connected.
+             */
+            const ControlRateBuffer* pull() { return (mInput != nullptr) ? mInput->pull() : nullptr; }
+
+        private:
+            friend class ControlRateOutputPin;
+
+            ControlRateOutputPin* mInput = nullptr;
+            ControlRateInputPin* mNextConnection = nullptr; // Next input connected to the same output
+        };
+
+    }
+
+}
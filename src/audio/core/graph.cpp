@@ -8,6 +8,9 @@
 #include <rtti/rttiutilities.h>
 #include <nap/objectgraph.h>
 
+// Audio includes
+#include <audio/utility/nodeprofiler.h>
+
 
 // RTTI
 RTTI_BEGIN_CLASS(nap::audio::Graph)
@@ -86,29 +89,79 @@ namespace nap
         };
 
         
-        bool GraphInstance::init(Graph& resource, NodeManager& nodeManager, utility::ErrorState& errorState)
+        bool Graph::init(utility::ErrorState& errorState)
+        {
+            // Build the plan before any instance is created, the objects may have changed since it was last built
+            mPlanBuilt = buildInstantiationPlan(errorState);
+            return mPlanBuilt;
+        }
+
+
+        const Graph::InstantiationPlan* Graph::getInstantiationPlan(utility::ErrorState& errorState) const
+        {
+            if (!errorState.check(mPlanBuilt, "Graph has not been initialized: %s", mID.c_str()))
+                return nullptr;
+            return &mPlan;
+        }
+
+
+        bool Graph::buildInstantiationPlan(utility::ErrorState& errorState)
         {
-            mNodeManager = &nodeManager;
-            
             // Build object graph as utility to sort all the audio object resources in dependency order
             std::vector<AudioObject*> objects;
-            for (auto& object : resource.mObjects)
+            for (auto& object : mObjects)
                 objects.emplace_back(object.get());
             
             ObjectGraph<AudioGraphItem> graph;
             if (!graph.build(objects, [](AudioObject* object) { return AudioGraphItem::create(object); }, errorState))
             {
-                errorState.fail("Failed to build audio graph %s", resource.mID.c_str());
+                errorState.fail("Failed to build audio graph %s", mID.c_str());
                 return false;
             }
             
             // Sort in order of depenedency
-            auto sortedNodes = graph.getSortedNodes();
+            mPlan = InstantiationPlan();
+            for (auto& node : graph.getSortedNodes())
+            {
+                auto object = node->mItem.mObject;
+                if (object == mOutput.get())
+                    mPlan.mOutputIndex = mPlan.mObjects.size();
+                if (object == mInput.get())
+                    mPlan.mInputIndex = mPlan.mObjects.size();
+                mPlan.mObjects.emplace_back(object);
+            }
+
+            if (mOutput == nullptr || mPlan.mOutputIndex < 0)
+            {
+                errorState.fail("Output not found: %s", (mOutput != nullptr) ? mOutput->mID.c_str() : mID.c_str());
+                return false;
+            }
+
+            if (mInput != nullptr && mPlan.mInputIndex < 0)
+            {
+                errorState.fail("Input not found: %s", mInput->mID.c_str());
+                return false;
+            }
+
+            return true;
+        }
+
+
+        bool GraphInstance::init(Graph& resource, NodeManager& nodeManager, utility::ErrorState& errorState)
+        {
+            mNodeManager = &nodeManager;
+            
+            auto plan = resource.getInstantiationPlan(errorState);
+            if (plan == nullptr)
+            {
+                errorState.fail("Failed to instantiate graph %s", resource.mID.c_str());
+                return false;
+            }
             
-            for (auto& node : sortedNodes)
+            mObjects.reserve(plan->mObjects.size());
+            for (auto objectResource : plan->mObjects)
             {
                 // Create instance and initialize
-                auto objectResource = node->mItem.mObject;
                 auto instance = objectResource->instantiate<AudioObjectInstance>(nodeManager, errorState);
                 
                 if (instance == nullptr)
@@ -117,26 +170,23 @@ namespace nap
                     return false;
                 }
                 
-                mObjects.emplace_back(std::move(instance));
-            }
-                        
-            mOutput = getObject<AudioObjectInstance>(resource.mOutput->mID);
-            if (mOutput == nullptr)
-            {
-                errorState.fail("Output not found: %s", resource.mOutput->mID.c_str());
-                return false;
-            }
-            
-            if (resource.mInput != nullptr)
-            {
-                mInput = getObject<AudioObjectInstance>(resource.mInput->mID);
-                if (mInput == nullptr)
+#ifdef NAP_AUDIO_PROFILING
+                // Name the output nodes of the object for the profiler
+                for (auto channel = 0; channel < instance->getChannelCount(); ++channel)
                 {
-                    errorState.fail("Input not found: %s", resource.mInput->mID.c_str());
-                    return false;
+                    auto output = instance->getOutputForChannel(channel);
+                    if (output != nullptr)
+                        NodeProfiler::get().registerNode(output->getNode(), instance->getName());
                 }
+#endif
+
+                mObjects.emplace_back(std::move(instance));
             }
             
+            mOutput = mObjects[plan->mOutputIndex].get();
+            if (plan->mInputIndex >= 0)
+                mInput = mObjects[plan->mInputIndex].get();
+            
             return true;
         }
         
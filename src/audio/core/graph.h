@@ -33,14 +33,47 @@ namespace nap
         class NAPAPI Graph : public Resource
         {
             RTTI_ENABLE(Resource)
+        public:
+            /**
+             * The objects of the graph sorted in order of dependency, which is the order in which they are instantiated.
+             */
+            struct InstantiationPlan
+            {
+                std::vector<AudioObject*> mObjects; ///< Objects in order of instantiation
+                int mOutputIndex = -1;              ///< Index of the output object in mObjects
+                int mInputIndex = -1;               ///< Index of the input object in mObjects, -1 if the graph has no input
+            };
+
         public:
             Graph() = default;
 
+            /**
+             * Builds the instantiation plan of the graph.
+             * @param errorState Contains the error if the dependencies can not be resolved or the input or output is not part of the graph.
+             * @return True on success.
+             */
+            bool init(utility::ErrorState& errorState) override;
+
+            /**
+             * Returns the instantiation plan, which is built once in init() and shared by all instances of the graph.
+             * This saves building and sorting the object graph for every voice of a Polyphonic.
+             * The plan is not modified after init(), so instantiating a graph only reads it.
+             * @param errorState Contains the error if the graph has not been initialized successfully.
+             * @return The plan or nullptr on failure.
+             */
+            const InstantiationPlan* getInstantiationPlan(utility::ErrorState& errorState) const;
+
             std::vector<AudioObjectPtr> mObjects;        ///< Property: 'Objects' The audio objects managed by the graph that are part of its DSP network.
             
             ResourcePtr<AudioObject> mOutput = nullptr;  ///< Property: 'Output' Pointer to an audio object in the graph that will be polled for output in order to present audio output.
             
             ResourcePtr<AudioObject> mInput = nullptr;   ///< Property: 'Input' Pointer to an effect object in the graph where audio input will be connected to.
+
+        private:
+            bool buildInstantiationPlan(utility::ErrorState& errorState);
+
+            InstantiationPlan mPlan;
+            bool mPlanBuilt = false;
         };
         
         
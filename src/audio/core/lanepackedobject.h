@@ -0,0 +1,144 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Audio includes
+#include <audio/core/nodeobject.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        // Forward declarations
+        template <typename NodeType> class LanePackedObjectInstance;
+
+
+        /**
+         * Lane packed variant of ParallelNodeObject. Instead of a node per channel, the channels are processed in groups by nodes with one lane per channel, see LanePackedNode.
+         * Has the same 'Input' and 'ChannelCount' properties as ParallelNodeObject.
+         * @tparam NodeType The type of the nodes that process one group of channels, with a static laneCount and getInput(lane) and getOutput(lane) methods.
+         */
+        template <typename NodeType>
+        class NAPAPI LanePackedObject : public ParallelNodeObjectBase
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            LanePackedObject() = default;
+
+            // Inherited from AudioObject
+            std::unique_ptr<AudioObjectInstance> createInstance(NodeManager& nodeManager, utility::ErrorState& errorState) override;
+
+        private:
+            /**
+             * Override this method to add custom initialization behaviour for each group's node.
+             * @param group The index of the group, which processes channels group * laneCount up to (group + 1) * laneCount.
+             * @param node The node being initialized.
+             * @param errorState Logs errors during the node's initialization.
+             * @return True on sucess.
+             */
+            virtual bool initNode(int group, NodeType& node, utility::ErrorState& errorState) { return true; }
+        };
+
+
+        /**
+         * Instance of LanePackedObject.
+         * @tparam NodeType
+         */
+        template <typename NodeType>
+        class NAPAPI LanePackedObjectInstance : public AudioObjectInstance
+        {
+            RTTI_ENABLE(AudioObjectInstance)
+
+        public:
+            LanePackedObjectInstance() = default;
+
+            /**
+             * Initializes the instance by constructing a node of type NodeType for each group of channels.
+             * @param channelCount Number of processing channels.
+             * @param nodeManager The NodeManager the nodes will be processed on.
+             * @param errorState Logs errors during the initialization.
+             * @return True on success.
+             */
+            bool init(int channelCount, NodeManager& nodeManager, utility::ErrorState& errorState);
+
+            /**
+             * @return The number of nodes that process the channels.
+             */
+            int getGroupCount() const { return mGroups.size(); }
+
+            /**
+             * @return The node that processes a group of channels, or nullptr if the group is out of bounds.
+             */
+            NodeType* getGroup(unsigned int group) { return group < mGroups.size() ? mGroups[group].getRaw() : nullptr; }
+
+            // Inherited from AudioObjectInstance
+            OutputPin* getOutputForChannel(int channel) override { return &mGroups[channel / NodeType::laneCount]->getOutput(channel % NodeType::laneCount); }
+            int getChannelCount() const override { return mChannelCount; }
+            void connect(unsigned int channel, OutputPin& pin) override { mGroups[channel / NodeType::laneCount]->getInput(channel % NodeType::laneCount).connect(pin); }
+            int getInputChannelCount() const override { return mChannelCount; }
+
+        private:
+            std::vector<SafeOwner<NodeType>> mGroups;
+            int mChannelCount = 0;
+        };
+
+
+        // Template definitions
+
+        template <typename NodeType>
+        std::unique_ptr<AudioObjectInstance> LanePackedObject<NodeType>::createInstance(NodeManager& nodeManager, utility::ErrorState& errorState)
+        {
+            auto instance = std::make_unique<LanePackedObjectInstance<NodeType>>();
+            if (!instance->init(mChannelCount, nodeManager, errorState))
+                return nullptr;
+
+            for (auto group = 0; group < instance->getGroupCount(); ++group)
+                if (!initNode(group, *instance->getGroup(group), errorState))
+                {
+                    errorState.fail("Failed to init node of group %i", group);
+                    return nullptr;
+                }
+
+            if (mInput != nullptr)
+                for (auto channel = 0; channel < instance->getInputChannelCount(); ++channel)
+                    instance->connect(channel, *mInput->getInstance()->getOutputForChannel(channel % mInput->getInstance()->getChannelCount()));
+
+            return std::move(instance);
+        }
+
+
+        template <typename NodeType>
+        bool LanePackedObjectInstance<NodeType>::init(int channelCount, NodeManager& nodeManager, utility::ErrorState& errorState)
+        {
+            if (channelCount <= 0)
+            {
+                errorState.fail("Channel count has to be larger than 0.");
+                return false;
+            }
+
+            mChannelCount = channelCount;
+            auto groupCount = (channelCount + NodeType::laneCount - 1) / NodeType::laneCount;
+            for (auto group = 0; group < groupCount; ++group)
+            {
+                auto node = nodeManager.makeSafe<NodeType>(nodeManager);
+
+                if (node == nullptr)
+                {
+                    errorState.fail("Failed to create node.");
+                    return false;
+                }
+
+                mGroups.emplace_back(std::move(node));
+            }
+
+            return true;
+        }
+
+    }
+
+}
@@ -4,17 +4,40 @@
 
 #include "nestednodemanager.h"
 
+// Std includes
+#include <thread>
+#include <algorithm>
+
+// Audio includes
+#include <audio/utility/denormals.h>
+#include <audio/utility/nodeprofiler.h>
+
 namespace nap
 {
 
     namespace audio
     {
 
-        void NestedNodeManagerNode::init(int inputChannelCount, int outputChannelCount, int internalBufferSize)
+        NestedNodeManagerNode::~NestedNodeManagerNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+
+            // Joins the worker thread before the buffers it operates on are destroyed.
+            mWorker = nullptr;
+        }
+
+
+        void NestedNodeManagerNode::init(int inputChannelCount, int outputChannelCount, int internalBufferSize, int upSampleFactor, int downSampleFactor, bool asynchronous)
         {
+            assert(upSampleFactor >= 1 && downSampleFactor >= 1);
+            assert(upSampleFactor == 1 || downSampleFactor == 1);
+            mUpSampleFactor = upSampleFactor;
+            mDownSampleFactor = downSampleFactor;
+            mAsynchronous = asynchronous;
+
             mNestedNodeManager.setInputChannelCount(inputChannelCount);
             mNestedNodeManager.setOutputChannelCount(outputChannelCount);
-            mNestedNodeManager.setSampleRate(getNodeManager().getSampleRate());
+            mNestedNodeManager.setSampleRate(getNodeManager().getSampleRate() * mUpSampleFactor / mDownSampleFactor);
             mNestedNodeManager.setInternalBufferSize(internalBufferSize);
 
             for (auto i = 0; i < outputChannelCount; ++i)
@@ -27,34 +50,206 @@ namespace nap
                 _mInputs.emplace_back(InputPin(this));
                 mInputBuffers.emplace_back(nullptr);
             }
+
+            if (isResampling())
+            {
+                // Signals entering the nested system are converted to the nested rate, signals leaving it are converted back.
+                for (auto i = 0; i < inputChannelCount; ++i)
+                {
+                    if (mUpSampleFactor > 1)
+                        mInputResamplers.emplace_back(std::make_unique<UpSampler>(mUpSampleFactor));
+                    else
+                        mInputResamplers.emplace_back(std::make_unique<DownSampler>(mDownSampleFactor));
+                }
+                for (auto i = 0; i < outputChannelCount; ++i)
+                {
+                    if (mUpSampleFactor > 1)
+                        mOutputResamplers.emplace_back(std::make_unique<DownSampler>(mUpSampleFactor));
+                    else
+                        mOutputResamplers.emplace_back(std::make_unique<UpSampler>(mDownSampleFactor));
+                }
+                mResampledInputBuffers.resize(inputChannelCount);
+                mResampledOutputBuffers.resize(outputChannelCount);
+                mNestedInputBuffers.resize(inputChannelCount, nullptr);
+                for (auto& buffer : mResampledOutputBuffers)
+                    mNestedOutputBuffers.emplace_back(&buffer);
+
+                // The group delays of the resampling filters are expressed on the higher of both samplerates.
+                auto inputDelay = mInputResamplers.empty() ? 0.f : mInputResamplers[0]->getDelay();
+                auto outputDelay = mOutputResamplers.empty() ? 0.f : mOutputResamplers[0]->getDelay();
+                mResamplingLatency = (inputDelay + outputDelay) / mUpSampleFactor;
+            }
+
+            if (mAsynchronous)
+            {
+                for (auto slot = 0; slot < 2; ++slot)
+                {
+                    auto& buffers = mSlots[slot];
+                    buffers.mInputBuffers.resize(inputChannelCount);
+                    buffers.mOutputBuffers.resize(outputChannelCount);
+                    buffers.mInputs.resize(inputChannelCount, nullptr);
+                    for (auto& buffer : buffers.mOutputBuffers)
+                        buffers.mOutputs.emplace_back(&buffer);
+                    buffers.mTask = [this, slot](){ processSlot(slot); };
+                }
+
+                // A single realtime thread that processes the queued blocks in order.
+                mWorker = std::make_unique<ThreadPool>(1, 2, true);
+            }
+
+            bufferSizeChanged(getBufferSize());
+        }
+
+
+        float NestedNodeManagerNode::getLatency() const
+        {
+            if (mAsynchronous)
+                return mResamplingLatency + getBufferSize();
+            return mResamplingLatency;
         }
 
 
         void NestedNodeManagerNode::process()
         {
+            // Inputs are always pulled on the audio thread, as pulling processes the upstream part of the parent graph.
             for (auto i = 0; i < _mInputs.size(); ++i)
+                mInputBuffers[i] = _mInputs[i].pull();
+
+            NAP_AUDIO_NODE_SCOPE();
+            for (auto i = 0; i < _mOutputs.size(); ++i)
+                mOutputBuffers[i] = &getOutputBuffer(_mOutputs[i]);
+
+            if (mAsynchronous)
+                processAsynchronous();
+            else
+                processNestedNodeManager(mInputBuffers, mOutputBuffers);
+        }
+
+
+        void NestedNodeManagerNode::processNestedNodeManager(std::vector<SampleBuffer*>& inputBuffers, std::vector<SampleBuffer*>& outputBuffers)
+        {
+            if (!isResampling())
             {
-                auto inputBuffer = _mInputs[i].pull();
-                if (inputBuffer == nullptr)
-                    mInputBuffers[i] = nullptr;
-                else
-                    mInputBuffers[i] = inputBuffer;
+                mNestedNodeManager.process(inputBuffers, outputBuffers, getBufferSize());
+                return;
             }
 
-            for (auto i = 0; i < _mOutputs.size(); ++i)
+            assert(getBufferSize() % mDownSampleFactor == 0);
+            auto nestedBufferSize = getNestedBufferSize();
+
+            for (auto i = 0; i < inputBuffers.size(); ++i)
             {
-                auto outputBuffer = &getOutputBuffer(_mOutputs[i]);
-                mOutputBuffers[i] = outputBuffer;
+                if (inputBuffers[i] == nullptr)
+                    mNestedInputBuffers[i] = nullptr;
+                else {
+                    mInputResamplers[i]->process(inputBuffers[i]->data(), getBufferSize(), mResampledInputBuffers[i].data());
+                    mNestedInputBuffers[i] = &mResampledInputBuffers[i];
+                }
+            }
+
+            mNestedNodeManager.process(mNestedInputBuffers, mNestedOutputBuffers, nestedBufferSize);
+
+            for (auto i = 0; i < outputBuffers.size(); ++i)
+                mOutputResamplers[i]->process(mResampledOutputBuffers[i].data(), nestedBufferSize, outputBuffers[i]->data());
+        }
+
+
+        void NestedNodeManagerNode::processAsynchronous()
+        {
+            // Output the result of the previous block, or silence if the worker did not finish it in time.
+            auto& previous = mSlots[1 - mWriteSlot];
+            if (previous.mState.load(std::memory_order_acquire) == SlotState::Done)
+            {
+                for (auto i = 0; i < mOutputBuffers.size(); ++i)
+                    std::copy(previous.mOutputBuffers[i].begin(), previous.mOutputBuffers[i].end(), mOutputBuffers[i]->begin());
+                previous.mState.store(SlotState::Free, std::memory_order_release);
+            }
+            else {
+                for (auto& outputBuffer : mOutputBuffers)
+                    std::fill(outputBuffer->begin(), outputBuffer->end(), 0.f);
+            }
+
+            // The input is dropped when the worker has not yet finished the block that was queued in this slot two blocks ago.
+            // An unread late result in this slot is discarded.
+            auto& current = mSlots[mWriteSlot];
+            if (current.mState.load(std::memory_order_acquire) != SlotState::Queued)
+            {
+                for (auto i = 0; i < mInputBuffers.size(); ++i)
+                {
+                    auto inputBuffer = mInputBuffers[i];
+                    if (inputBuffer == nullptr)
+                        current.mInputs[i] = nullptr;
+                    else {
+                        std::copy(inputBuffer->begin(), inputBuffer->end(), current.mInputBuffers[i].begin());
+                        current.mInputs[i] = &current.mInputBuffers[i];
+                    }
+                }
+                current.mState.store(SlotState::Queued, std::memory_order_release);
+                mWorker->execute(current.mTask);
+            }
+            mWriteSlot = 1 - mWriteSlot;
+        }
+
+
+        void NestedNodeManagerNode::processSlot(int slot)
+        {
+            // The worker is a thread of its own, flush to zero is per thread. Setting the flags is cheap, so this also covers a replaced worker.
+            enableFlushToZero();
+
+            NAP_AUDIO_RTCHECK_SCOPE();
+            auto& buffers = mSlots[slot];
+            processNestedNodeManager(buffers.mInputs, buffers.mOutputs);
+            buffers.mState.store(SlotState::Done, std::memory_order_release);
+        }
+
+
+        void NestedNodeManagerNode::waitForWorker()
+        {
+            for (auto& slot : mSlots)
+                while (slot.mState.load(std::memory_order_acquire) == SlotState::Queued)
+                    std::this_thread::yield();
+        }
+
+
+        void NestedNodeManagerNode::sampleRateChanged(float sampleRate)
+        {
+            waitForWorker();
+            mNestedNodeManager.setSampleRate(sampleRate * mUpSampleFactor / mDownSampleFactor);
+        }
+
+
+        void NestedNodeManagerNode::bufferSizeChanged(int bufferSize)
+        {
+            // The worker can not be processing while its buffers are being resized.
+            waitForWorker();
+
+            auto nestedBufferSize = bufferSize * mUpSampleFactor / mDownSampleFactor;
+            for (auto& buffer : mResampledInputBuffers)
+                buffer.resize(nestedBufferSize, 0.f);
+            for (auto& buffer : mResampledOutputBuffers)
+                buffer.resize(nestedBufferSize, 0.f);
+            for (auto& slot : mSlots)
+            {
+                for (auto& buffer : slot.mInputBuffers)
+                    buffer.resize(bufferSize, 0.f);
+                for (auto& buffer : slot.mOutputBuffers)
+                    buffer.resize(bufferSize, 0.f);
             }
-            mNestedNodeManager.process(mInputBuffers, mOutputBuffers, getBufferSize());
         }
 
 
         bool NestedNodeManagerInstance::init(NodeManager &nodeManager, int inputChannelCount, int outputChannelCount,
-                                             int internalBufferSize, utility::ErrorState &errorState)
+                                             int internalBufferSize, int upSampleFactor, int downSampleFactor, bool asynchronous, utility::ErrorState &errorState)
         {
+            if (!errorState.check(upSampleFactor >= 1 && downSampleFactor >= 1, "Resampling factors have to be at least 1"))
+                return false;
+            if (!errorState.check(upSampleFactor == 1 || downSampleFactor == 1, "Cannot both up- and downsample a nested node manager"))
+                return false;
+            if (!errorState.check(nodeManager.getInternalBufferSize() % downSampleFactor == 0, "The parent buffersize has to be a multiple of the downsample factor"))
+                return false;
+
             mNode = nodeManager.makeSafe<NestedNodeManagerNode>(nodeManager);
-            mNode->init(inputChannelCount, outputChannelCount, internalBufferSize);
+            mNode->init(inputChannelCount, outputChannelCount, internalBufferSize, upSampleFactor, downSampleFactor, asynchronous);
             return true;
         }
 
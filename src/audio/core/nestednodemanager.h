@@ -4,9 +4,19 @@
 
 #pragma once
 
+// Std includes
+#include <memory>
+#include <atomic>
+#include <functional>
+
+// Nap includes
+#include <utility/threading.h>
+
+// Audio includes
 #include <audio/core/audionode.h>
 #include <audio/core/audionodemanager.h>
 #include <audio/core/nodeobject.h>
+#include <audio/utility/resampler.h>
 
 namespace nap
 {
@@ -16,7 +26,13 @@ namespace nap
 
         /**
          * A node that manages a nested node manager. The nested node manager can contain a DSP network that runs on a lower buffersize than the main node system. This is useful for more time-accurate scheduling of events or parameter changes.
-         * The @NestedNodeManager has its own internal buffersize, input channel count and output channel count. The sample rate should be the same as the main node manager's samplerate. A possible new feature in the future could be resampling so the nested node manager can run on a different samplerate than the main system as well.
+         * The @NestedNodeManager has its own internal buffersize, input channel count and output channel count.
+         * The nested node manager can run on a different samplerate than the main system: a whole number multiple of it to oversample nonlinear processing like FM or saturation, or a whole number fraction of it to run control-rate or analysis networks more cheaply.
+         * The signals are resampled at the boundary using polyphase FIR filters, see @UpSampler and @DownSampler.
+         * In asynchronous mode the nested node manager is processed on its own realtime worker thread, in parallel with the rest of the parent graph.
+         * Inputs and outputs are double buffered: each block hands its input to the worker and outputs the result the worker produced for the previous block, so the output is delayed by one block of the parent node manager.
+         * The audio thread never waits for the worker. When the worker has not finished a block in time that block outputs silence, and input is dropped while the worker is a full block behind.
+         * Use getLatency() to compensate other signal paths, for example using a @CompensationDelayNode.
          */
         class NAPAPI NestedNodeManagerNode : public Node
         {
@@ -27,13 +43,19 @@ namespace nap
              */
             NestedNodeManagerNode(NodeManager& parentNodeManager) : Node(parentNodeManager), mNestedNodeManager(parentNodeManager.getDeletionQueue()) { }
 
+            // Destructor, waits for the worker thread in asynchronous mode to finish.
+            ~NestedNodeManagerNode();
+
             /**
              * Initialize the node.
              * @param inputChannelCount the numebr of input channels the nested node manager has
              * @param outputChannelCount  the number of output channels the nested node manager has
-             * @param internalBufferSize the internal buffersize of the nested node manager. Should be smaller than the parent node manager's.
+             * @param internalBufferSize the internal buffersize of the nested node manager. Should be smaller than the parent node manager's buffersize multiplied by the upSampleFactor and divided by the downSampleFactor.
+             * @param upSampleFactor the nested node manager runs on the parent's samplerate multiplied by this factor. Use 2 or 4 for oversampling.
+             * @param downSampleFactor the nested node manager runs on the parent's samplerate divided by this factor. The parent's buffersize has to be a multiple of this factor. Cannot be combined with an upSampleFactor other than 1.
+             * @param asynchronous if true the nested node manager is processed on a dedicated realtime worker thread, adding one parent block of latency.
              */
-            void init(int inputChannelCount, int outputChannelCount, int internalBufferSize);
+            void init(int inputChannelCount, int outputChannelCount, int internalBufferSize, int upSampleFactor = 1, int downSampleFactor = 1, bool asynchronous = false);
 
             /**
              * @return input pin with given index that will be fed into the nested node system.
@@ -61,14 +83,81 @@ namespace nap
              */
             NodeManager& getNestedNodeManager() { return mNestedNodeManager; }
 
+            /**
+             * @return the factor by which the nested samplerate is higher than the parent samplerate.
+             */
+            int getUpSampleFactor() const { return mUpSampleFactor; }
+
+            /**
+             * @return the factor by which the nested samplerate is lower than the parent samplerate.
+             */
+            int getDownSampleFactor() const { return mDownSampleFactor; }
+
+            /**
+             * @return true if the nested node manager is processed on its own worker thread.
+             */
+            bool isAsynchronous() const { return mAsynchronous; }
+
+            /**
+             * @return the delay in samples of the parent node manager between the inputs and the outputs of this node.
+             * This is the sum of the group delay of the resampling filters and one parent block in asynchronous mode.
+             */
+            float getLatency() const;
+
         private:
             void process() override;
+            void sampleRateChanged(float sampleRate) override;
+            void bufferSizeChanged(int bufferSize) override;
+
+            // Processes the nested node manager for one block of the parent. Input and output buffers run on the parent's samplerate.
+            void processNestedNodeManager(std::vector<SampleBuffer*>& inputBuffers, std::vector<SampleBuffer*>& outputBuffers);
+
+            // Outputs the previous block of the worker and hands the current input to it.
+            void processAsynchronous();
+
+            // Called on the worker thread to process the block in the given slot.
+            void processSlot(int slot);
+
+            // Blocks until the worker thread has finished all queued blocks. Only used when the configuration changes, never per block.
+            void waitForWorker();
+
+            bool isResampling() const { return mUpSampleFactor > 1 || mDownSampleFactor > 1; }
+            int getNestedBufferSize() const { return getBufferSize() * mUpSampleFactor / mDownSampleFactor; }
 
             NodeManager mNestedNodeManager;
             std::vector<InputPin> _mInputs;
             std::vector<OutputPin> _mOutputs;
             std::vector<audio::SampleBuffer*> mOutputBuffers;
             std::vector<audio::SampleBuffer*> mInputBuffers;
+
+            int mUpSampleFactor = 1;
+            int mDownSampleFactor = 1;
+            std::vector<std::unique_ptr<Resampler>> mInputResamplers;
+            std::vector<std::unique_ptr<Resampler>> mOutputResamplers;
+            std::vector<SampleBuffer> mResampledInputBuffers;
+            std::vector<SampleBuffer> mResampledOutputBuffers;
+            std::vector<SampleBuffer*> mNestedInputBuffers;
+            std::vector<SampleBuffer*> mNestedOutputBuffers;
+            float mResamplingLatency = 0.f; // In samples on the parent's samplerate
+
+            // Ownership of a slot, handed back and forth between the audio thread and the worker.
+            enum class SlotState { Free, Queued, Done };
+
+            // Buffers of one block that is processed by the worker.
+            struct Slot
+            {
+                std::vector<SampleBuffer> mInputBuffers;    // Copies of the inputs
+                std::vector<SampleBuffer> mOutputBuffers;   // Output of the worker, copied to the output pins one block later
+                std::vector<SampleBuffer*> mInputs;
+                std::vector<SampleBuffer*> mOutputs;
+                std::atomic<SlotState> mState = { SlotState::Free };
+                std::function<void()> mTask = nullptr;      // Created once so handing a block to the worker does not allocate
+            };
+
+            bool mAsynchronous = false;
+            Slot mSlots[2];
+            int mWriteSlot = 0; // Slot that receives the input of the current block, the other slot holds the output of the previous block
+            std::unique_ptr<ThreadPool> mWorker = nullptr;
         };
 
 
@@ -81,7 +170,35 @@ namespace nap
             NestedNodeManagerInstance() = default;
             NestedNodeManagerInstance(const std::string& name) : AudioObjectInstance(name) { }
 
-            bool init(NodeManager& nodeManager, int inputChannelCount, int outputChannelCount, int internalBufferSize, utility::ErrorState& errorState);
+            /**
+             * Initializes the instance.
+             * @param nodeManager the parent node manager
+             * @param inputChannelCount the number of input channels of the nested node manager
+             * @param outputChannelCount the number of output channels of the nested node manager
+             * @param internalBufferSize the internal buffersize of the nested node manager
+             * @param upSampleFactor the nested node manager runs on the parent's samplerate multiplied by this factor
+             * @param downSampleFactor the nested node manager runs on the parent's samplerate divided by this factor
+             * @param asynchronous process the nested node manager on its own realtime worker thread, see @NestedNodeManagerNode
+             * @param errorState contains the error when initialization fails
+             * @return true on success
+             */
+            bool init(NodeManager& nodeManager, int inputChannelCount, int outputChannelCount, int internalBufferSize, int upSampleFactor, int downSampleFactor, bool asynchronous, utility::ErrorState& errorState);
+
+            /**
+             * Initializes the instance with synchronous processing.
+             */
+            bool init(NodeManager& nodeManager, int inputChannelCount, int outputChannelCount, int internalBufferSize, int upSampleFactor, int downSampleFactor, utility::ErrorState& errorState)
+            {
+                return init(nodeManager, inputChannelCount, outputChannelCount, internalBufferSize, upSampleFactor, downSampleFactor, false, errorState);
+            }
+
+            /**
+             * Initializes the instance running on the parent node manager's samplerate.
+             */
+            bool init(NodeManager& nodeManager, int inputChannelCount, int outputChannelCount, int internalBufferSize, utility::ErrorState& errorState)
+            {
+                return init(nodeManager, inputChannelCount, outputChannelCount, internalBufferSize, 1, 1, false, errorState);
+            }
 
             // Inherited from AudioObjectInstance
             OutputPin* getOutputForChannel(int channel) override { return &mNode->getOutput(channel); }
@@ -99,6 +216,11 @@ namespace nap
              */
             Process& getProcess() { return *mNode; }
 
+            /**
+             * @return The delay in samples of the parent node manager that the nested node manager adds to the signal.
+             */
+            float getLatency() const { return mNode->getLatency(); }
+
         private:
             SafeOwner<NestedNodeManagerNode> mNode = nullptr;
         };
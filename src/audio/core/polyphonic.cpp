@@ -22,6 +22,10 @@ RTTI_BEGIN_CLASS(nap::audio::PolyphonicInstance)
 	RTTI_FUNCTION("playSection", &nap::audio::PolyphonicInstance::playSection)
     RTTI_FUNCTION("playOnChannels", &nap::audio::PolyphonicInstance::playOnChannels)
     RTTI_FUNCTION("stop", &nap::audio::PolyphonicInstance::stop)
+    RTTI_FUNCTION("playAt", &nap::audio::PolyphonicInstance::playAt)
+    RTTI_FUNCTION("playSectionAt", &nap::audio::PolyphonicInstance::playSectionAt)
+    RTTI_FUNCTION("stopAt", &nap::audio::PolyphonicInstance::stopAt)
+    RTTI_FUNCTION("getSampleTime", &nap::audio::PolyphonicInstance::getSampleTime)
     RTTI_FUNCTION("getBusyVoiceCount", &nap::audio::PolyphonicInstance::getBusyVoiceCount)
 RTTI_END_CLASS
 
@@ -170,6 +174,35 @@ namespace nap
         }
 
 
+        void PolyphonicInstance::playAt(VoiceInstance* voice, DiscreteTimeValue time, TimeValue duration)
+        {
+            if (!voice)
+                return;
+
+            voice->playAt(time, duration);
+            connectVoice(voice);
+        }
+
+
+        void PolyphonicInstance::playSectionAt(VoiceInstance* voice, DiscreteTimeValue time, int startSegment, int endSegment, ControllerValue startValue, TimeValue totalDuration)
+        {
+            if (!voice)
+                return;
+
+            voice->playSectionAt(time, startSegment, endSegment, startValue, totalDuration);
+            connectVoice(voice);
+        }
+
+
+        void PolyphonicInstance::stopAt(VoiceInstance* voice, DiscreteTimeValue time, TimeValue fadeOutTime)
+        {
+            if (!voice)
+                return;
+
+            voice->stopAt(time, fadeOutTime);
+        }
+
+
         void PolyphonicInstance::reset()
         {
             for (auto& voice : mVoices)
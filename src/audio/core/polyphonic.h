@@ -132,6 +132,42 @@ namespace nap
              */
             void stop(VoiceInstance* voice, TimeValue fadeOutTime);
 
+            /**
+             * Schedules a voice to start playing at an exact sample time and connects it's output to this object's mixer.
+             * The voice's envelope starts at the sample within the processed buffer that corresponds to the given time, so the timing is independent of the buffer size.
+             * Before being passed to this method a voice has te be acquired and reserved for use using findFreeVoice().
+             * @param voice The voice to be played.
+             * @param time Absolute sample time of the node manager at which the voice starts. Use getSampleTime() plus a margin of at least one buffer to make sure the time has not passed yet when the event arrives on the audio thread.
+             * @param duration The total duration of the envelope. This parameter will only have effect if the voice's envelope data has segments with a relative duration. See Envelope for more info.
+             */
+            void playAt(VoiceInstance* voice, DiscreteTimeValue time, TimeValue duration = 0);
+
+            /**
+             * Schedules a section of the envelope of a voice to start playing at an exact sample time and connects it's output to this object's mixer.
+             * Before being passed to this method a voice has te be acquired and reserved for use using findFreeVoice().
+             * @param voice The voice that the envelope section will be played on.
+             * @param time Absolute sample time of the node manager at which the voice starts.
+             * @param startSegment The index of the starting segment of the voice envelope's subsection that will be triggered.
+             * @param endSegment The index of the ending segment of the voice envelope's subsection that will be triggered.
+             * @param startValue As envelope segments only define their destination value, this parameter can be used to define the starting value of the first segment. Normally this will be 0 to avoid clicks and pops.
+             * @param totalDuration The total duration of the envelope's subsection. This parameter will only have effect if the voice's envelope data has segments with a relative duration. See Envelope for more info.
+             */
+            void playSectionAt(VoiceInstance* voice, DiscreteTimeValue time, int startSegment, int endSegment, ControllerValue startValue = 0, TimeValue totalDuration = 0);
+
+            /**
+             * Schedules a voice to start fading out it's envelope at an exact sample time.
+             * Once the envelope is faded out this will trigger the voice to be disconnected from this object's output mixers
+             * @param voice The voice to be stopped.
+             * @param time Absolute sample time of the node manager at which the fade out starts.
+             * @param fadeOutTime The fadeout time in ms.
+             */
+            void stopAt(VoiceInstance* voice, DiscreteTimeValue time, TimeValue fadeOutTime);
+
+            /**
+             * @return The current absolute sample time of the node manager, used as reference to schedule voices.
+             */
+            DiscreteTimeValue getSampleTime() const { return mNodeManager->getSampleTime(); }
+
             /**
              * Stops the polyphonic hard by disconnecting all its voices.
              * Only call this while the polyphonic is not being processed, otherwise it will result in clicks and pops.
@@ -30,6 +30,9 @@ RTTI_BEGIN_CLASS(nap::audio::VoiceInstance)
     RTTI_FUNCTION("play", &nap::audio::VoiceInstance::play)
 	RTTI_FUNCTION("playSection", &nap::audio::VoiceInstance::playSection)
     RTTI_FUNCTION("stop", &nap::audio::VoiceInstance::stop)
+    RTTI_FUNCTION("playAt", &nap::audio::VoiceInstance::playAt)
+    RTTI_FUNCTION("playSectionAt", &nap::audio::VoiceInstance::playSectionAt)
+    RTTI_FUNCTION("stopAt", &nap::audio::VoiceInstance::stopAt)
     RTTI_FUNCTION("getFinishedSignal", &nap::audio::VoiceInstance::getFinishedSignal)
 RTTI_END_CLASS
 
@@ -86,6 +89,26 @@ namespace nap
         {
             mEnvelope->stop(rampTime);
         }
+
+
+        void VoiceInstance::playAt(DiscreteTimeValue time, TimeValue duration)
+        {
+            mEnvelope->scheduleTrigger(time, duration);
+            mStartTime = time;
+        }
+
+
+        void VoiceInstance::playSectionAt(DiscreteTimeValue time, int startSegment, int endSegment, ControllerValue startValue, TimeValue totalDuration)
+        {
+            mEnvelope->scheduleTriggerSection(time, startSegment, endSegment, startValue, totalDuration);
+            mStartTime = time;
+        }
+
+
+        void VoiceInstance::stopAt(DiscreteTimeValue time, TimeValue rampTime)
+        {
+            mEnvelope->scheduleStop(time, rampTime);
+        }
         
         
         bool VoiceInstance::try_use()
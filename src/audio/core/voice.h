@@ -78,6 +78,31 @@ namespace nap
              * @param fadeOutTime The fadeout time in ms from the moment this method is called.
              */
             void stop(TimeValue rampTime);
+
+            /**
+             * Schedules playback of the voice to start at an exact sample time by scheduling a trigger of the envelope.
+             * The envelope will start at the sample within the processed buffer that corresponds to the given time, independent of the buffer size.
+             * @param time Absolute sample time of the node manager at which the voice starts. Use NodeManager::getSampleTime() plus a margin of at least one buffer to make sure the time has not passed yet when the event arrives on the audio thread.
+             * @param duration The total duration of the envelope. This parameter will only have effect if the voice's envelope data has segments with a relative duration. See Envelope for more info.
+             */
+            void playAt(DiscreteTimeValue time, TimeValue duration = 0);
+
+            /**
+             * Schedules playback of a section of the voice envelope to start at an exact sample time.
+             * @param time Absolute sample time of the node manager at which the voice starts.
+             * @param startSegment The index of the starting segment of the voice envelope's subsection that will be triggered.
+             * @param endSegment The index of the ending segment of the voice envelope's subsection that will be triggered.
+             * @param startValue As envelope segments only define their destination value, this parameter can be used to define the starting value of the first segment. Normally this will be 0 to avoid clicks and pops.
+             * @param totalDuration The total duration of the envelope's subsection. This parameter will only have effect if the voice's envelope data has segments with a relative duration. See Envelope for more info.
+             */
+            void playSectionAt(DiscreteTimeValue time, int startSegment, int endSegment, ControllerValue startValue = 0, TimeValue totalDuration = 0);
+
+            /**
+             * Schedules the voice to start fading out its envelope at an exact sample time.
+             * @param time Absolute sample time of the node manager at which the fade out starts.
+             * @param rampTime The fadeout time in ms.
+             */
+            void stopAt(DiscreteTimeValue time, TimeValue rampTime);
             
             /**
              * @return True if this voice is currently playing or reserved for usage.
@@ -85,7 +110,7 @@ namespace nap
             bool isBusy() const { return mBusy; }
             
             /**
-             * @return When the voice is busy, the time the voice started playing
+             * @return When the voice is busy, the time the voice started or is scheduled to start playing
              */
             DiscreteTimeValue getStartTime() const { return mStartTime; }
 
@@ -6,6 +6,7 @@
 
 // Audio includes
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
 
 namespace nap
 {
@@ -23,6 +24,12 @@ namespace nap
         }
 
 
+        AudioFileReaderNode::~AudioFileReaderNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
 		void AudioFileReaderNode::setPlaying(bool value)
 		{
 			assert(mAudioFileDescriptor != nullptr);
@@ -51,6 +58,7 @@ namespace nap
 
         void AudioFileReaderNode::process()
         {
+            NAP_AUDIO_NODE_SCOPE();
             auto& outputBuffer = getOutputBuffer(audioOutput);
 
             if (mPlaying == 0)
@@ -27,6 +27,7 @@ namespace nap
 
         public:
             AudioFileReaderNode(NodeManager& nodeManager, unsigned int bufferSize);
+            ~AudioFileReaderNode() override;
 
 			/**
 			 * Sets the audio file descriptor. Needs to ba called before starting playback.
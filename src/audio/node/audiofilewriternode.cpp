@@ -6,6 +6,7 @@
 
 // Audio includes
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
 
 namespace nap
 {
@@ -28,6 +29,7 @@ namespace nap
 
         AudioFileWriterNode::~AudioFileWriterNode()
         {
+            NAP_AUDIO_NODE_RELEASE();
             if (mRootProcess)
                 getNodeManager().unregisterRootProcess(*this);
         }
@@ -67,6 +69,7 @@ namespace nap
         void AudioFileWriterNode::process()
         {
             auto inputBuffer = audioInput.pull();
+            NAP_AUDIO_NODE_SCOPE();
             std::memcpy(mBufferQueue[mInputIndex].data(), inputBuffer->data(), mBufferSizeInBytes);
             mThread.enqueue([&](){
                 if (mActive > 0 && mAudioFileDescriptor != nullptr)
@@ -6,6 +6,7 @@
 
 // Audio includes
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
 
 namespace nap
 {
@@ -39,8 +40,15 @@ namespace nap
         }
         
         
+        BufferUpdateProcess::~BufferUpdateProcess()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
         void BufferUpdateProcess::process()
         {
+            NAP_AUDIO_NODE_SCOPE();
             for (auto& buffer : mBuffers)
                 buffer->update();
         }
@@ -46,6 +46,7 @@ namespace nap
         {
         public:
             BufferUpdateProcess(NodeManager& nodeManager) : Process(nodeManager) { }
+            ~BufferUpdateProcess() override;
 
             /**
              * Registers a BufferNode to be updated by this BufferUpdateProcess.
@@ -4,8 +4,14 @@
 
 #include "circularbuffernode.h"
 
+// Std includes
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
 // Nap includes
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::CircularBufferNode)
     RTTI_PROPERTY("audioInput", &nap::audio::CircularBufferNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
@@ -20,7 +26,8 @@ namespace nap
         
         CircularBufferNode::CircularBufferNode(NodeManager& nodeManager, unsigned int bufferSize, bool rootProcess) : Node(nodeManager), mRootProcess(rootProcess)
         {
-//            TODO check if bufferSize is power of two
+            // The write position is wrapped with wrap(), which requires a power of two
+            assert(bufferSize > 0 && (bufferSize & (bufferSize - 1)) == 0);
             mBuffer.resize(bufferSize);
             
             if (rootProcess)
@@ -30,6 +37,7 @@ namespace nap
         
         CircularBufferNode::~CircularBufferNode()
         {
+            NAP_AUDIO_NODE_RELEASE();
             if (mRootProcess)
                 getNodeManager().unregisterRootProcess(*this);
         }
@@ -37,33 +45,37 @@ namespace nap
         
         void CircularBufferNode::process()
         {
-			std::lock_guard<std::mutex> lock(mMutex);
-
             auto inputBuffer = audioInput.pull();
-            if (inputBuffer == nullptr)
+            NAP_AUDIO_NODE_SCOPE();
+
+            if (mClearRequested.exchange(false, std::memory_order_acquire))
+                std::memset(mBuffer.data(), 0, mBuffer.size() * sizeof(SampleValue));
+
+            const SampleValue* input = (inputBuffer != nullptr) ? inputBuffer->data() : nullptr;
+
+            // Write the block in contiguous parts that are split where the write position wraps around.
+            int remaining = getBufferSize();
+            while (remaining > 0)
             {
-                for (auto i = 0; i < getBufferSize(); ++i)
+                auto position = wrap(mWritePosition, mBuffer.size());
+                int count = std::min<int>(remaining, mBuffer.size() - position);
+                if (input != nullptr)
                 {
-                    mBuffer[wrap(mWritePosition, mBuffer.size())] = 0;
-                    mWritePosition++;
-                }
-            }
-            else {
-                for (float i : *inputBuffer)
-                {
-                    mBuffer[wrap(mWritePosition, mBuffer.size())] = i;
-                    mWritePosition++;
+                    std::memcpy(&mBuffer[position], input, count * sizeof(SampleValue));
+                    input += count;
                 }
+                else
+                    std::memset(&mBuffer[position], 0, count * sizeof(SampleValue));
+
+                mWritePosition += count;
+                remaining -= count;
             }
         }
 
 
 		void CircularBufferNode::clear()
 		{
-			std::lock_guard<std::mutex> lock(mMutex);
-
-			for (auto i = 0; i < mBuffer.size(); ++i)
-				mBuffer[i] = 0.f;
+			mClearRequested.store(true, std::memory_order_release);
 		}
 
 
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <audio/core/audionode.h>
 #include <audio/utility/audiofunctions.h>
 #include <audio/utility/safeptr.h>
@@ -55,7 +57,13 @@ namespace nap
             DiscreteTimeValue getAbsolutePosition(unsigned int relativePosition) const { return wrap(mWritePosition - relativePosition, mBuffer.size()); }
 
 			/**
-			 * Clears the contents of the buffer. Either perform this on the audio thread or while the node is not processing.
+			 * @return The circular buffer itself, for readers that process blocks of samples. Its size is a power of two. Only read it on the audio thread.
+			 */
+			const SampleBuffer& getBuffer() const { return mBuffer; }
+
+			/**
+			 * Requests the contents of the buffer to be cleared. Can be called from any thread.
+			 * The buffer is cleared on the audio thread at the start of the next process() call, before new input is written.
 			 */
 			void clear();
             
@@ -67,7 +75,7 @@ namespace nap
             
             bool mRootProcess = false;
 
-			std::mutex mMutex; // Mutex lock to guard against probably false positive thread sanitizer warnings about process() and clear().
+			std::atomic<bool> mClearRequested = { false }; // Set by clear(), consumed by process() on the audio thread.
         };
         
     }
@@ -4,6 +4,9 @@
 
 #include "circularbufferplayernode.h"
 
+// Audio includes
+#include <audio/utility/nodeprofiler.h>
+
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::CircularBufferPlayerNode)
     RTTI_PROPERTY("audioOutput", &nap::audio::CircularBufferPlayerNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
     RTTI_FUNCTION("play", &nap::audio::CircularBufferPlayerNode::play)
@@ -17,6 +20,12 @@ namespace nap
     {
         
         
+        CircularBufferPlayerNode::~CircularBufferPlayerNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
         void CircularBufferPlayerNode::play(CircularBufferNode& buffer, int relativePosition, ControllerValue speed)
         {
             mNewRelativePosition = relativePosition;
@@ -35,6 +44,7 @@ namespace nap
         
         void CircularBufferPlayerNode::process()
         {
+            NAP_AUDIO_NODE_SCOPE();
             auto& outputBuffer = getOutputBuffer(audioOutput);
             
             if (mIsDirty.check())
@@ -29,6 +29,7 @@ namespace nap
             
         public:
             CircularBufferPlayerNode(NodeManager& manager) : Node(manager) { }
+            ~CircularBufferPlayerNode() override;
         
             /**
              * The output to connect to other nodes
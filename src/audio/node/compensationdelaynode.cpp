@@ -0,0 +1,74 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "compensationdelaynode.h"
+
+// Std includes
+#include <cmath>
+#include <algorithm>
+
+// Audio includes
+#include <audio/utility/nodeprofiler.h>
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::CompensationDelayNode)
+    RTTI_PROPERTY("input", &nap::audio::CompensationDelayNode::input, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_PROPERTY("output", &nap::audio::CompensationDelayNode::output, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_FUNCTION("setDelay", &nap::audio::CompensationDelayNode::setDelay)
+    RTTI_FUNCTION("setLatency", &nap::audio::CompensationDelayNode::setLatency)
+    RTTI_FUNCTION("getDelay", &nap::audio::CompensationDelayNode::getDelay)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        CompensationDelayNode::CompensationDelayNode(NodeManager& manager, int maxDelay) : Node(manager)
+        {
+            // One extra sample, as the buffer also holds the sample that is being written.
+            auto size = 1;
+            while (size < maxDelay + 1)
+                size *= 2;
+            mBuffer.resize(size, 0.f);
+            mMask = size - 1;
+        }
+
+
+        CompensationDelayNode::~CompensationDelayNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
+        void CompensationDelayNode::setDelay(int samples)
+        {
+            mDelay = std::max(0, std::min(samples, mMask));
+        }
+
+
+        void CompensationDelayNode::setLatency(float latency)
+        {
+            setDelay(int(std::lround(latency)));
+        }
+
+
+        void CompensationDelayNode::process()
+        {
+            auto inputBuffer = input.pull();
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(output);
+            auto delay = mDelay.load();
+
+            for (auto i = 0; i < outputBuffer.size(); ++i)
+            {
+                mBuffer[mWriteIndex] = (inputBuffer != nullptr) ? (*inputBuffer)[i] : 0.f;
+                outputBuffer[i] = mBuffer[(mWriteIndex - delay) & mMask];
+                mWriteIndex = (mWriteIndex + 1) & mMask;
+            }
+        }
+
+    }
+
+}
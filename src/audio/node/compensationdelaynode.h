@@ -0,0 +1,67 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <atomic>
+#include <vector>
+
+// Audio includes
+#include <audio/core/audionode.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Delays a signal by a whole number of samples without interpolation, smoothing or feedback.
+         * Used to align a signal path with a path that has latency, for example the output of an asynchronous or resampling @NestedNodeManagerNode.
+         */
+        class NAPAPI CompensationDelayNode : public Node
+        {
+        public:
+            /**
+             * Constructor
+             * @param manager NodeManager the node is processed on.
+             * @param maxDelay The maximum delay in samples. Will be rounded up to a power of 2.
+             */
+            CompensationDelayNode(NodeManager& manager, int maxDelay = 8192);
+            ~CompensationDelayNode() override;
+
+            InputPin input = { this }; /**< The audio input receiving the signal to be delayed. */
+            OutputPin output = { this }; /**< The audio output with the delayed signal. */
+
+            /**
+             * Sets the delay in samples. Changes take effect immediately without smoothing.
+             * @param samples The delay in samples, clamped to the maximum delay.
+             */
+            void setDelay(int samples);
+
+            /**
+             * Sets the delay to compensate a latency in samples that might be fractional, as reported by NestedNodeManagerNode::getLatency().
+             * The latency is rounded to the nearest whole sample.
+             * @param latency The latency in samples.
+             */
+            void setLatency(float latency);
+
+            /**
+             * @return The delay in samples.
+             */
+            int getDelay() const { return mDelay.load(); }
+
+        private:
+            void process() override;
+
+            std::vector<SampleValue> mBuffer;
+            int mMask = 0;
+            int mWriteIndex = 0;
+            std::atomic<int> mDelay = { 0 };
+        };
+
+    }
+
+}
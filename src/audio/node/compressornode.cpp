@@ -5,6 +5,7 @@
 #include "compressornode.h"
 
 #include <cmath>
+#include <audio/utility/nodeprofiler.h>
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::CompressorNode)
     RTTI_PROPERTY("audioInput", &nap::audio::CompressorNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
@@ -52,9 +53,16 @@ namespace nap {
         }
 
 
+        CompressorNode::~CompressorNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
         void CompressorNode::process()
         {
             auto& inputBuffer = *audioInput.pull();
+            NAP_AUDIO_NODE_SCOPE();
             auto& outputBuffer = getOutputBuffer(audioOutput);
 
             // Converts std::vector to float arrays
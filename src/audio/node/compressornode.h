@@ -97,6 +97,7 @@ namespace nap
                 setAttack(0.0008);
                 setRelease(0.5);
             }
+            ~CompressorNode() override;
             
             InputPin audioInput = { this };     ///< Audio input pin
             OutputPin audioOutput = { this };   ///< Audio output pin
@@ -5,8 +5,12 @@
 #include "delaynode.h"
 
 #include <audio/utility/audiofunctions.h>
+#include <audio/utility/bufferstate.h>
+#include <audio/utility/denormals.h>
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
 #include <cmath>
+#include <algorithm>
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::DelayNode)
     RTTI_PROPERTY("input", &nap::audio::DelayNode::input, nap::rtti::EPropertyMetaData::Embedded)
@@ -30,6 +34,12 @@ namespace nap
             mTime.setStepCount(manager.getSamplesPerMillisecond() * 10);
             mDryWet.setStepCount(manager.getSamplesPerMillisecond() * 10);
         }
+
+
+        DelayNode::~DelayNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
         
         
         void DelayNode::setTime(TimeValue value, TimeValue rampTime)
@@ -49,10 +59,25 @@ namespace nap
         void DelayNode::process()
         {
             auto inputBuffer = input.pull();
+            NAP_AUDIO_NODE_SCOPE();
             auto& outputBuffer = getOutputBuffer(output);
             auto feedback = mFeedback.load();
             SampleValue delayedSample = 0;
-            
+
+            // When the input is silent and the delay line has been silent for longer than the delay time, the output is silent too.
+            // Zeros still have to be written to keep the delay line consistent, but reading and mixing can be skipped.
+            if ((inputBuffer == nullptr || isSilent(*inputBuffer)) && !mTime.isRamping() && mSilentSampleCount > mTime.getValue() + 1)
+            {
+                for (auto i = 0; i < outputBuffer.size(); ++i)
+                {
+                    mDelay.write(0.f);
+                    mDryWet.getNextValue();
+                }
+                std::fill(outputBuffer.begin(), outputBuffer.end(), 0.f);
+                mSilentSampleCount += outputBuffer.size();
+                return;
+            }
+
             if (inputBuffer)
             {
                 for (auto i = 0; i < outputBuffer.size(); ++i)
@@ -62,7 +87,9 @@ namespace nap
                     else
                         delayedSample = mDelay.read(mTime.getNextValue());
                     
-                    mDelay.write((*inputBuffer)[i] + delayedSample * feedback);
+                    auto sample = flushDenormal((*inputBuffer)[i] + delayedSample * feedback);
+                    mDelay.write(sample);
+                    mSilentSampleCount = (sample == 0.f) ? mSilentSampleCount + 1 : 0;
                     outputBuffer[i] = lerp((*inputBuffer)[i], delayedSample, mDryWet.getNextValue());
                 }
             }
@@ -75,7 +102,9 @@ namespace nap
                     else
                         delayedSample = mDelay.read(mTime.getNextValue());
                     
-                    mDelay.write(0.f + delayedSample * feedback);
+                    auto sample = flushDenormal(delayedSample * feedback);
+                    mDelay.write(sample);
+                    mSilentSampleCount = (sample == 0.f) ? mSilentSampleCount + 1 : 0;
                     outputBuffer[i] = lerp(0.f, delayedSample, mDryWet.getNextValue());
                 }
             }
@@ -6,6 +6,7 @@
 
 // Std includes
 #include <atomic>
+#include <cstdint>
 
 // Audio includes
 #include <audio/core/audionode.h>
@@ -30,6 +31,7 @@ namespace nap
              * @param delayLineSize The size in samples of the delay line. Has to be a power of 2.
              */
             DelayNode(NodeManager& manager, int delayLineSize = 65536 * 8);
+            ~DelayNode() override;
             
             InputPin input = { this }; /**< The audio input receiving the signal to be delayed. */
             OutputPin output = { this }; /**< The audio output with the processed signal. */
@@ -76,6 +78,7 @@ namespace nap
             LinearSmoothedValue<float> mTime = { 0, 44 }; // in samples
             LinearSmoothedValue<ControllerValue> mDryWet = { 0.5f, 44 };
             std::atomic<ControllerValue> mFeedback = { 0.f };
+            int64_t mSilentSampleCount = 0; // Number of consecutive zeros written to the delay line, 64 bit so it does not overflow on installations that run continuously
         };
         
     }
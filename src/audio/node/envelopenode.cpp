@@ -4,8 +4,12 @@
 
 #include "envelopenode.h"
 
+// Std includes
+#include <algorithm>
+
 // Audio includes
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
 
 // RTTI include
 #include <rtti/rtti.h>
@@ -40,6 +44,12 @@ namespace nap
         }
 
 
+        EnvelopeNode::~EnvelopeNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
         void EnvelopeNode::trigger(TimeValue totalDuration)
         {
             trigger(0, mEnvelope.size() - 1, 0, totalDuration);
@@ -48,20 +58,7 @@ namespace nap
 
         void EnvelopeNode::trigger(int startSegment, int endSegment, ControllerValue startValue, TimeValue totalDuration)
         {
-            auto absoluteDuration = 0.f;
-            auto relativeDuration = 0.f;
-            for (auto i = startSegment; i <= endSegment; ++i)
-            {
-                auto& segment = mEnvelope[i];
-                if (!segment.mDurationRelative)
-                    absoluteDuration += segment.mDuration;
-                else
-                    relativeDuration += segment.mDuration;
-            }
-
-            mTotalRelativeDuration = (totalDuration - absoluteDuration) / relativeDuration;
-            if (mTotalRelativeDuration < 0)
-                mTotalRelativeDuration = 0;
+            mTotalRelativeDuration = calculateTotalRelativeDuration(startSegment, endSegment, totalDuration);
 
             mNewEndSegment.store(endSegment);
             mNewCurrentSegment.store(startSegment);
@@ -80,13 +77,52 @@ namespace nap
         }
 
 
-        void EnvelopeNode::playSegment(int index)
+        bool EnvelopeNode::scheduleTrigger(DiscreteTimeValue time, int startSegment, int endSegment, ControllerValue startValue, TimeValue totalDuration)
         {
-            auto envelope = mEnvelope;
+            Event event;
+            event.mStartSegment = startSegment;
+            event.mEndSegment = endSegment;
+            event.mStartValue = startValue;
+            event.mTotalRelativeDuration = calculateTotalRelativeDuration(startSegment, endSegment, totalDuration);
+            return mScheduledEvents.enqueue(time, event);
+        }
+
 
-            assert(index < envelope.size());
+        bool EnvelopeNode::scheduleStop(DiscreteTimeValue time, TimeValue rampTime)
+        {
+            assert(rampTime > 0.f);
+            Event event;
+            event.mStop = true;
+            event.mFadeOutTime = rampTime;
+            return mScheduledEvents.enqueue(time, event);
+        }
+
+
+        TimeValue EnvelopeNode::calculateTotalRelativeDuration(int startSegment, int endSegment, TimeValue totalDuration) const
+        {
+            auto absoluteDuration = 0.f;
+            auto relativeDuration = 0.f;
+            for (auto i = startSegment; i <= endSegment; ++i)
+            {
+                auto& segment = mEnvelope[i];
+                if (!segment.mDurationRelative)
+                    absoluteDuration += segment.mDuration;
+                else
+                    relativeDuration += segment.mDuration;
+            }
+
+            auto result = (totalDuration - absoluteDuration) / relativeDuration;
+            if (result < 0)
+                result = 0;
+            return result;
+        }
+
+
+        void EnvelopeNode::playSegment(int index)
+        {
+            assert(index < mEnvelope.size());
             mCurrentSegment = index;
-            auto& segment = envelope[index];
+            auto& segment = mEnvelope[index];
             mTranslate = segment.mTranslate;
 
             if (segment.mDurationRelative)
@@ -117,24 +153,153 @@ namespace nap
         }
 
 
-        void EnvelopeNode::process()
+        void EnvelopeNode::applyEvent(const Event& event)
         {
-            updateEnvelope();
-            auto& outputBuffer = getOutputBuffer(output);
+            if (event.mStop)
+            {
+                mCurrentSegment = mEndSegment;
+                mValue.ramp(0.f, event.mFadeOutTime * getNodeManager().getSamplesPerMillisecond(), RampMode::Linear);
+            }
+            else {
+                mCurrentSegment = event.mStartSegment;
+                mEndSegment = event.mEndSegment;
+                mTotalRelativeDuration = event.mTotalRelativeDuration;
+                mValue.setValue(event.mStartValue);
+                if (mCurrentSegment <= mEndSegment)
+                    playSegment(mCurrentSegment);
+            }
+        }
+
+
+        void EnvelopeNode::fill(SampleBuffer& buffer, int begin, int end)
+        {
+            // Outside of a segment the output is constant, typically zero for a finished envelope.
+            if (!mValue.isRamping())
+            {
+                auto value = mValue.getValue();
+                if (mTranslate && mTranslator != nullptr)
+                    value = mTranslator->translate(value);
+                std::fill(buffer.begin() + begin, buffer.begin() + end, value);
+                return;
+            }
 
             if (mTranslate && mTranslator != nullptr)
             {
-                for (auto i = 0; i < outputBuffer.size(); ++i)
+                for (auto i = begin; i < end; ++i)
                 {
-                    outputBuffer[i] = mTranslator->translate(mValue.getNextValue());
+                    buffer[i] = mTranslator->translate(mValue.getNextValue());
                 }
             }
             else {
-                for (auto i = 0; i < outputBuffer.size(); ++i)
+                for (auto i = begin; i < end; ++i)
                 {
-                    outputBuffer[i] = mValue.getNextValue();
+                    buffer[i] = mValue.getNextValue();
                 }
             }
+        }
+
+
+        void EnvelopeNode::fillControlRate(ControlRateBuffer& buffer, int begin, int end)
+        {
+            auto interval = buffer.getInterval();
+            auto last = buffer.getBufferSize() - 1;
+
+            if (!mValue.isRamping() && begin < end)
+            {
+                auto value = mValue.getValue();
+                if (mTranslate && mTranslator != nullptr)
+                    value = mTranslator->translate(value);
+                for (auto i = begin / interval; i <= (end - 1) / interval; ++i)
+                    buffer[i] = value;
+                return;
+            }
+
+            for (auto i = begin; i < end; ++i)
+            {
+                auto value = mValue.getNextValue();
+                if ((i + 1) % interval == 0 || i == last)
+                    buffer[i / interval] = (mTranslate && mTranslator != nullptr) ? mTranslator->translate(value) : value;
+            }
+        }
+
+
+        template <typename FillFunction>
+        void EnvelopeNode::advance(int size, FillFunction fill)
+        {
+            updateEnvelope();
+            mScheduledEvents.update();
+
+            if (mScheduledEvents.isEmpty())
+                fill(0, size);
+            else {
+                // Split the buffer at the offsets of the scheduled events
+                auto bufferStartTime = getNodeManager().getSampleTime();
+                auto position = 0;
+                while (position < size)
+                {
+                    Event event;
+                    while (mScheduledEvents.pop(bufferStartTime + position, event))
+                        applyEvent(event);
+                    auto next = mScheduledEvents.getNextEventOffset(bufferStartTime, size);
+                    fill(position, next);
+                    position = next;
+                }
+            }
+        }
+
+
+        void EnvelopeNode::process()
+        {
+            NAP_AUDIO_NODE_SCOPE();
+            auto sampleTime = getSampleTime();
+
+            // The audio rate output has already been calculated for this buffer by processControlRate().
+            if (mAudioRateProcessedSample == sampleTime)
+                return;
+
+            auto& outputBuffer = getOutputBuffer(output);
+            mAudioRateProcessedSample = sampleTime;
+
+            // The envelope has already been advanced at control rate only, because the audio output was not connected.
+            if (mControlRateProcessedSample == sampleTime)
+            {
+                controlOutput.pull()->render(outputBuffer.data());
+                return;
+            }
+
+            calculateAudioRate(outputBuffer);
+        }
+
+
+        void EnvelopeNode::processControlRate(ControlRateBuffer& buffer)
+        {
+            auto sampleTime = getSampleTime();
+            mControlRateProcessedSample = sampleTime;
+
+            // When the audio output is used it is calculated exactly and the control rate values are taken from it.
+            if (mAudioRateProcessedSample != sampleTime && output.isConnected())
+            {
+                mAudioRateProcessedSample = sampleTime;
+                calculateAudioRate(getOutputBuffer(output));
+            }
+
+            if (mAudioRateProcessedSample == sampleTime)
+            {
+                auto& outputBuffer = getOutputBuffer(output);
+                auto interval = buffer.getInterval();
+                for (auto i = 0; i < buffer.getValueCount(); ++i)
+                    buffer[i] = outputBuffer[std::min((i + 1) * interval, buffer.getBufferSize()) - 1];
+                return;
+            }
+
+            advance(buffer.getBufferSize(), [&](int begin, int end){ fillControlRate(buffer, begin, end); });
+            mCurrentValue.store(buffer.getEndValue());
+        }
+
+
+        void EnvelopeNode::calculateAudioRate(SampleBuffer& outputBuffer)
+        {
+            advance(outputBuffer.size(), [&](int begin, int end){ fill(outputBuffer, begin, end); });
             mCurrentValue.store(outputBuffer.back());
         }
 
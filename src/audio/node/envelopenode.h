@@ -14,6 +14,8 @@
 #include <audio/utility/dirtyflag.h>
 #include <audio/utility/rampedvalue.h>
 #include <audio/utility/translator.h>
+#include <audio/utility/eventqueue.h>
+#include <audio/core/controlrate.h>
 
 // Nap includes
 #include <nap/signalslot.h>
@@ -27,8 +29,9 @@ namespace nap
         /**
          * Envelope generator that can trigger envelopes to generate a control signal.
          * Envelopes are specified as an array of segments with a duration and a destination value.
+         * The envelope can be read at audio rate from the output pin or at control rate from the controlOutput pin.
          */
-        class NAPAPI EnvelopeNode : public Node
+        class NAPAPI EnvelopeNode : public Node, public ControlRateSource
         {
             RTTI_ENABLE(Node)
         public:
@@ -55,12 +58,20 @@ namespace nap
              * @param translator SafePtr to a @Translator object that manages a function to translate the envelope's output for certain segments. Generally contains an @EqualPowerTranslator.
              */
             EnvelopeNode(NodeManager& manager, const Envelope& envelope, SafePtr<Translator<ControllerValue>> translator);
+            ~EnvelopeNode() override;
 
             /**
              * The output signal pin
              */
             OutputPin output = { this };
 
+            /**
+             * The output signal at control rate, one value per 16 samples.
+             * When both outputs are used the envelope is calculated once at audio rate and the control rate values are taken from it, so the audio output stays exact.
+             * When only this output is connected the envelope is calculated at control rate only.
+             */
+            ControlRateOutputPin controlOutput = { this, this };
+
             /**
              * Triggers an envelope.
              * @param totalDuration: if this value is greater than the total of all durations of segments that have durationRelative = false
@@ -85,6 +96,28 @@ namespace nap
              */
             void stop(TimeValue rampTime = 5);
 
+            /**
+             * Schedules a section of the envelope to be triggered at an exact sample time.
+             * The trigger will be applied on the audio thread at the sample within the buffer that corresponds to the given time.
+             * Scheduled events are applied in the order of their time. A time in the past triggers at the start of the next buffer.
+             * @param time Absolute sample time of the node manager at which the section will be triggered. See NodeManager::getSampleTime().
+             * @param startSegment: the start segment of the envelope section to be played
+             * @param endSegment: the end segment of the envelope section to be played
+             * @param startValue: the startValue of the line when the section is triggered.
+             * @param totalDuration: if this value is greater than the total of all durations of segments that have durationRelative = false
+             the resting time wille be divided over the segments with durationRelative = true, using their duration values as denominator.
+             * @return False if the event queue was full and the trigger was dropped.
+             */
+            bool scheduleTrigger(DiscreteTimeValue time, int startSegment, int endSegment, ControllerValue startValue = 0, TimeValue totalDuration = 0);
+
+            /**
+             * Schedules the envelope to fade out to zero at an exact sample time.
+             * @param time Absolute sample time of the node manager at which the fade out will start.
+             * @param rampTime The time in ms the envelope generator takes to fade from its value at the given time out to zero.
+             * @return False if the event queue was full and the stop was dropped.
+             */
+            bool scheduleStop(DiscreteTimeValue time, TimeValue rampTime = 5);
+
             /**
              * @return The current output value of the envelope generator.
              */
@@ -112,10 +145,31 @@ namespace nap
             int getCurrentSegment() { return mCurrentSegment; }
             
         private:
+            // Event scheduled to be applied at a specific sample time
+            struct Event
+            {
+                bool mStop = false;
+                int mStartSegment = 0;
+                int mEndSegment = 0;
+                ControllerValue mStartValue = 0.f;
+                TimeValue mTotalRelativeDuration = 0.f;
+                TimeValue mFadeOutTime = 0.f;
+            };
+
             void process() override;
+            void processControlRate(ControlRateBuffer& buffer) override;
+
+            // Advances the envelope over one buffer, applying the scheduled events at their exact sample.
+            template <typename FillFunction>
+            void advance(int size, FillFunction fill);
 
             void playSegment(int index);
             void updateEnvelope();
+            void applyEvent(const Event& event);
+            void calculateAudioRate(SampleBuffer& outputBuffer);
+            void fill(SampleBuffer& buffer, int begin, int end);
+            void fillControlRate(ControlRateBuffer& buffer, int begin, int end);
+            TimeValue calculateTotalRelativeDuration(int startSegment, int endSegment, TimeValue totalDuration) const;
 
             nap::Slot<ControllerValue> rampFinishedSlot = { this, &EnvelopeNode::rampFinished };
             void rampFinished(ControllerValue);
@@ -135,6 +189,11 @@ namespace nap
             DirtyFlag mIsDirty;
 
             TimeValue mTotalRelativeDuration = 0;
+
+            ScheduledEventQueue<Event> mScheduledEvents = { 32 };
+
+            DiscreteTimeValue mAudioRateProcessedSample = -1; // Sample time of the last buffer that was calculated at audio rate
+            DiscreteTimeValue mControlRateProcessedSample = -1; // Sample time of the last buffer that was calculated at control rate
         };
 
     }
@@ -4,8 +4,11 @@
 
 #include "filterbanknode.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::FilterBankNode)
     RTTI_PROPERTY("input", &nap::audio::FilterBankNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
@@ -20,15 +23,21 @@ namespace nap
     namespace audio
     {
         
-        float8 makeFloat8(const std::vector<float>& list)
+        float16 makeFloat16(const std::vector<float>& list)
         {
-            float8 result;
-            for (auto i = 0; i < 8; ++i)
+            float16 result;
+            for (auto i = 0; i < 16; ++i)
                 result[i] = list[i % list.size()];
             return result;
         }
         
         
+        // setParameters() empties the deletion queue on every call and the audio thread hands back at most one function per call, so it never holds more than two functions.
+        FilterBank::FilterBank() : mDeletionQueue(16)
+        {
+        }
+
+
         FilterBank::~FilterBank()
         {
 			UpdateFunction* functionToDelete = nullptr;
@@ -39,37 +48,43 @@ namespace nap
 
 		void FilterBank::setFilterCount(unsigned int count)
 		{
-			if (count <= 8)
+			if (count <= BiquadBankState::laneCount)
 				mFilterCount = count;
 			else
-				mFilterCount = 8;
+				mFilterCount = BiquadBankState::laneCount;
 		}
 
 
 		void FilterBank::setParameters(const std::vector<ControllerValue>& aCenterFrequency, const std::vector<ControllerValue>& aBandWidth, const std::vector<ControllerValue>& aGain, float aSampleRate)
         {
-            float8 centerFrequency = makeFloat8(aCenterFrequency);
-            float8 bandWidth = makeFloat8(aBandWidth);
-            float8 gain = makeFloat8(aGain);
-            float8 scaledGain = gain * powVec(float8(10000.0) / bandWidth, float8(0.5));
+            float16 centerFrequency = makeFloat16(aCenterFrequency);
+            float16 bandWidth = makeFloat16(aBandWidth);
+            float16 gain = makeFloat16(aGain);
+            float16 scaledGain = gain * powVec(float16(10000.0) / bandWidth, float16(0.5));
             
-            float8 sampleRate = float8(aSampleRate);
-            float8 zero = float8(0);
-            float8 one = float8(1);
-            float8 two = float8(2);
-
-            float8 c = one / tanVec(float8(math::PI) * bandWidth / sampleRate);
-            float8 d = two * cosVec(float8(math::PIX2) * centerFrequency / sampleRate);
-            float8 a0 = one / (one + c);
-            float8 a1 = zero;
-            float8 a2 = zero - a0;
-            float8 b1 = a2 * c * d;
-            float8 b2 = a0 * (c - one);
-            auto biquadPtr = &mFilter;
+            float16 sampleRate = float16(aSampleRate);
+            float16 zero = float16(0);
+            float16 one = float16(1);
+            float16 two = float16(2);
+
+            float16 c = one / tanVec(float16(math::PI) * bandWidth / sampleRate);
+            float16 d = two * cosVec(float16(math::PIX2) * centerFrequency / sampleRate);
+            float16 a0 = one / (one + c);
+            float16 a1 = zero;
+            float16 a2 = zero - a0;
+            float16 b1 = a2 * c * d;
+            float16 b2 = a0 * (c - one);
+
+            const float16 coefficients[BiquadBankState::coefficientCount] = { a0, a1, a2, b1, b2, scaledGain };
+            float targets[BiquadBankState::coefficientCount][BiquadBankState::laneCount];
+            for (auto coefficient = 0; coefficient < BiquadBankState::coefficientCount; ++coefficient)
+                for (auto lane = 0; lane < BiquadBankState::laneCount; ++lane)
+                    targets[coefficient][lane] = coefficients[coefficient][lane];
+            auto filtersPtr = &mFilters;
             
             auto updateFunction = new std::function<void()>(
-                [a0, a1, a2, b1, b2, scaledGain, biquadPtr](){
-                  biquadPtr->setCoefficients(a0, a1, a2, b1, b2, scaledGain);
+                [targets, filtersPtr](){
+                  filtersPtr->setCoefficients(targets);
                 }
             );
 			
@@ -99,25 +114,38 @@ namespace nap
 			if (updateFunction)
 			{
 				(*updateFunction)();
-				mDeletionQueue.enqueue(updateFunction);
+
+				// Hand the function back to the control thread for deletion. The queue is preallocated and try_enqueue() never allocates.
+				[[maybe_unused]] auto enqueued = mDeletionQueue.try_enqueue(updateFunction);
+				assert(enqueued);
 			}
 
-			for (auto i = 0; i < outputBuffer.size(); ++i)
+			// Processed in chunks so the low shelf can read the input before the filters overwrite it when processing in place
+			constexpr int chunkSize = 64;
+			float lowShelf[chunkSize];
+			const float lowShelfGain = mLowShelfGain;
+			for (auto start = 0; start < outputBuffer.size(); start += chunkSize)
 			{
-				const float8 inputValue(inputBuffer[i]);
-				const float8 outputValue = mFilter.process(inputValue);
-				float result = 0;
-				for (auto filterIndex = 0; filterIndex < filterCount; ++filterIndex)
-					result += outputValue[filterIndex];
-				result += mLowShelf.process(inputBuffer[i]) * mLowShelfGain;
-				outputBuffer[i] = result;
+				const int count = std::min<int>(chunkSize, outputBuffer.size() - start);
+				for (auto i = 0; i < count; ++i)
+					lowShelf[i] = mLowShelf.process(inputBuffer[start + i]) * lowShelfGain;
+				mKernels.processBiquadBank(mFilters, &inputBuffer[start], &outputBuffer[start], count, filterCount);
+				for (auto i = 0; i < count; ++i)
+					outputBuffer[start + i] += lowShelf[i];
 			}
 		}
         
         
+        FilterBankNode::~FilterBankNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
         void FilterBankNode::process()
         {
             auto& inputBuffer = *audioInput.pull();
+            NAP_AUDIO_NODE_SCOPE();
             auto& outputBuffer = getOutputBuffer(output);
 			mFilterBank.processBuffer(inputBuffer, outputBuffer);
         }
@@ -12,8 +12,9 @@
 #include <utility/threading.h>
 
 // Audio includes
-#include <audio/utility/biquad.h>
 #include <audio/utility/onepole.h>
+#include <audio/utility/vectorextension.h>
+#include <audio/utility/vectorkernels.h>
 
 #include <audio/core/audionode.h>
 #include <audio/utility/dirtyflag.h>
@@ -25,16 +26,17 @@ namespace nap
     {
 
 		/**
-		 * Processes a maximum of 8 parallel bandpass filters on the input signal using AVX2 optimization.
+		 * Processes a maximum of 16 parallel bandpass filters on the input signal.
+		 * The filters are processed by VectorKernels::processBiquadBank with the instruction set selected at runtime.
 		 */
 		class NAPAPI FilterBank
 		{
 		public:
-			FilterBank() = default;
+			FilterBank();
 			~FilterBank();
 
 			/**
-			 * Sets the number of filters being processed. The maximum is 8.
+			 * Sets the number of filters being processed. The maximum is 16.
 			 * @param count Number of filters being processed in parallel.
 			 */
 			void setFilterCount(unsigned int count);
@@ -45,7 +47,7 @@ namespace nap
 			int getFilterCount() const { return mFilterCount.load(); }
 
 			/**
-			 * Sets the parameters of all filters to the values within the vector arguments. If the sizes of the vectors are shorter than 8, the content will be repeated.
+			 * Sets the parameters of all filters to the values within the vector arguments. If the sizes of the vectors are shorter than 16, the content will be repeated.
 			 * @param centerFrequency Centerfrequency in Hz for each of the filters
 			 * @param bandWidth Bandwidths in Hz for each of the filters
 			 * @param gain Gain multiplier for each of the filters
@@ -70,13 +72,14 @@ namespace nap
 
 		private:
 			std::atomic<int> mFilterCount = { 1 };
-			BiquadFilter<float8> mFilter;
+			BiquadBankState mFilters;
+			const VectorKernels& mKernels = getVectorKernels();
             OnePoleLowPass<SampleValue> mLowShelf;
 			std::atomic<ControllerValue> mLowShelfGain = 0.f;
 
 			using UpdateFunction = std::function<void()>;
 			std::atomic<UpdateFunction*> mUpdateFunction = { nullptr };
-			moodycamel::ReaderWriterQueue<UpdateFunction*> mDeletionQueue;
+			moodycamel::ReaderWriterQueue<UpdateFunction*> mDeletionQueue; // Preallocated, the audio thread only uses try_enqueue()
 		};
      
         /**
@@ -88,12 +91,13 @@ namespace nap
             
         public:
             FilterBankNode(NodeManager& manager) : Node(manager) { }
+            ~FilterBankNode() override;
 
             InputPin audioInput = { this }; /**< The audio input receiving the signal to be processed. */
             OutputPin output = { this }; /**< The audio output with the processed signal. */
             
             /**
-             * Sets the number of filters being processed. The maximum is 8.
+             * Sets the number of filters being processed. The maximum is 16.
              * @param count Number of filters being processed in parallel.
              */
             void setFilterCount(unsigned int count) { mFilterBank.setFilterCount(count); }
@@ -104,7 +108,7 @@ namespace nap
             int getFilterCount() const { return mFilterBank.getFilterCount(); }
             
             /**
-             * Sets the parameters of all filters to the values within the vector arguments. If the sizes of the vectors are shorter than 8, the content will be repeated.
+             * Sets the parameters of all filters to the values within the vector arguments. If the sizes of the vectors are shorter than 16, the content will be repeated.
              * @param centerFrequency Centerfrequency in Hz for each of the filters
              * @param bandWidth Bandwidths in Hz for each of the filters
              * @param gain Gain multiplier for each of the filters
@@ -0,0 +1,29 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "fusedchainnode.h"
+
+RTTI_BEGIN_ENUM(nap::audio::BiquadKernel::Mode)
+    RTTI_ENUM_VALUE(nap::audio::BiquadKernel::Mode::LowPass, "LowPass"),
+    RTTI_ENUM_VALUE(nap::audio::BiquadKernel::Mode::HighPass, "HighPass"),
+    RTTI_ENUM_VALUE(nap::audio::BiquadKernel::Mode::BandPass, "BandPass")
+RTTI_END_ENUM
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::LowPassGainNode)
+    RTTI_PROPERTY("audioInput", &nap::audio::LowPassGainNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_PROPERTY("gainInput", &nap::audio::LowPassGainNode::gainInput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_PROPERTY("audioOutput", &nap::audio::LowPassGainNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::BiquadGainNode)
+    RTTI_PROPERTY("audioInput", &nap::audio::BiquadGainNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_PROPERTY("gainInput", &nap::audio::BiquadGainNode::gainInput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_PROPERTY("audioOutput", &nap::audio::BiquadGainNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::KarplusStrongGainNode)
+    RTTI_PROPERTY("audioInput", &nap::audio::KarplusStrongGainNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_PROPERTY("gainInput", &nap::audio::KarplusStrongGainNode::gainInput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_PROPERTY("audioOutput", &nap::audio::KarplusStrongGainNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
+RTTI_END_CLASS
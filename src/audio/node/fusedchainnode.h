@@ -0,0 +1,112 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/chainkernels.h>
+#include <audio/utility/nodeprofiler.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Node that runs a chain of per sample kernels in a single loop, see chainkernels.h.
+         * Every sample of audioInput passes through all kernels in order and is then multiplied by gainInput, for example an envelope.
+         * This replaces a Chain of nodes that each write a whole buffer that the next node reads back.
+         * @tparam Kernels The kernels in processing order.
+         */
+        template <typename... Kernels>
+        class NAPAPI FusedChainNode : public Node
+        {
+            RTTI_ENABLE(Node)
+
+        public:
+            FusedChainNode(NodeManager& nodeManager) : Node(nodeManager)
+            {
+                setSampleRate(nodeManager.getSampleRate());
+            }
+
+            ~FusedChainNode() override { NAP_AUDIO_NODE_RELEASE(); }
+
+            InputPin audioInput = { this };     ///< Input of the first kernel. Silence when not connected.
+            InputPin gainInput = { this };      ///< Multiplied with the output of the last kernel. Ignored when not connected.
+            OutputPin audioOutput = { this };   ///< Output of the chain.
+
+            /**
+             * Changes the parameters of a kernel. The function is called on the audio thread before the next buffer is processed.
+             * @tparam index Index of the kernel in the chain.
+             * @param function Function that takes a reference to the kernel.
+             */
+            template <std::size_t index, typename Function>
+            void update(Function function)
+            {
+                getNodeManager().enqueueTask([&, function](){ function(std::get<index>(mKernels)); });
+            }
+
+        private:
+            using Indices = std::index_sequence_for<Kernels...>;
+
+            // Inherited from Node
+            void process() override
+            {
+                auto input = audioInput.pull();
+                auto gain = gainInput.pull();
+                NAP_AUDIO_NODE_SCOPE();
+                auto& outputBuffer = getOutputBuffer(audioOutput);
+
+                for (auto i = 0; i < outputBuffer.size(); ++i)
+                {
+                    SampleValue value = processKernels((input != nullptr) ? (*input)[i] : 0.f, Indices());
+                    outputBuffer[i] = (gain != nullptr) ? value * (*gain)[i] : value;
+                }
+            }
+
+            void sampleRateChanged(float sampleRate) override { setSampleRate(sampleRate); }
+
+            template <std::size_t... indices>
+            SampleValue processKernels(SampleValue value, std::index_sequence<indices...>)
+            {
+                // Folds to one inlined expression with the output of each kernel as input of the next
+                ((value = std::get<indices>(mKernels).process(value)), ...);
+                return value;
+            }
+
+            void setSampleRate(float sampleRate)
+            {
+                std::apply([sampleRate](auto&... kernels){ (kernels.setSampleRate(sampleRate), ...); }, mKernels);
+            }
+
+            std::tuple<Kernels...> mKernels;
+        };
+
+
+        /**
+         * Lowpass filter followed by a gain.
+         */
+        using LowPassGainNode = FusedChainNode<OnePoleLowPassKernel, GainKernel>;
+
+        /**
+         * Biquad filter followed by a gain.
+         */
+        using BiquadGainNode = FusedChainNode<BiquadKernel, GainKernel>;
+
+        /**
+         * Karplus strong string with a highpass filter to remove DC, followed by a gain.
+         */
+        using KarplusStrongGainNode = FusedChainNode<KarplusStrongKernel, OnePoleHighPassKernel, GainKernel>;
+
+    }
+
+}
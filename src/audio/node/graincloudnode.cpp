@@ -0,0 +1,177 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "graincloudnode.h"
+
+// Std includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Audio includes
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
+
+RTTI_BEGIN_ENUM(nap::audio::GrainWindow)
+    RTTI_ENUM_VALUE(nap::audio::GrainWindow::Hann, "Hann"),
+    RTTI_ENUM_VALUE(nap::audio::GrainWindow::Triangle, "Triangle"),
+    RTTI_ENUM_VALUE(nap::audio::GrainWindow::Tukey, "Tukey"),
+    RTTI_ENUM_VALUE(nap::audio::GrainWindow::Gaussian, "Gaussian")
+RTTI_END_ENUM
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::GrainCloudNode)
+    RTTI_PROPERTY("audioOutput", &nap::audio::GrainCloudNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_FUNCTION("setDensity", &nap::audio::GrainCloudNode::setDensity)
+    RTTI_FUNCTION("setDuration", &nap::audio::GrainCloudNode::setDuration)
+    RTTI_FUNCTION("setPosition", &nap::audio::GrainCloudNode::setPosition)
+    RTTI_FUNCTION("setPositionJitter", &nap::audio::GrainCloudNode::setPositionJitter)
+    RTTI_FUNCTION("setSpeed", &nap::audio::GrainCloudNode::setSpeed)
+    RTTI_FUNCTION("setSpeedJitter", &nap::audio::GrainCloudNode::setSpeedJitter)
+    RTTI_FUNCTION("setGain", &nap::audio::GrainCloudNode::setGain)
+    RTTI_FUNCTION("setGainJitter", &nap::audio::GrainCloudNode::setGainJitter)
+    RTTI_FUNCTION("setWindow", &nap::audio::GrainCloudNode::setWindow)
+    RTTI_FUNCTION("trigger", &nap::audio::GrainCloudNode::trigger)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        GrainCloudNode::GrainCloudNode(NodeManager& manager, int maxGrainCount) : Node(manager), mPool(maxGrainCount)
+        {
+            // Give every node its own random sequence by mixing a global counter with the address of the node
+            static std::atomic<unsigned int> instanceCounter = { 0 };
+            auto seed = static_cast<unsigned int>(instanceCounter.fetch_add(1) * 2654435761u) ^ static_cast<unsigned int>(reinterpret_cast<std::uintptr_t>(this) >> 4);
+            seed ^= seed >> 16;
+            seed *= 0x45d9f3bu;
+            seed ^= seed >> 16;
+            mRandomState = (seed != 0) ? seed : 1; // The xorshift generator gets stuck at zero
+        }
+
+
+        GrainCloudNode::~GrainCloudNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
+        void GrainCloudNode::setBuffer(CircularBufferNode* buffer)
+        {
+            mNewCircularBuffer.store(buffer);
+        }
+
+
+        void GrainCloudNode::setBuffer(SafePtr<MultiSampleBuffer> buffer, int channel, float sampleRate)
+        {
+            getNodeManager().enqueueTask([&, buffer, channel, sampleRate](){
+                mBuffer = buffer;
+                mChannel = channel;
+                mBufferSampleRate = sampleRate;
+            });
+        }
+
+
+        void GrainCloudNode::process()
+        {
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(audioOutput);
+            const int bufferSize = outputBuffer.size();
+
+            mCircularBuffer = mNewCircularBuffer.load();
+
+            // Select the source, the circular buffer takes precedence
+            const SampleValue* source = nullptr;
+            int sourceSize = 0;
+            bool circular = false;
+            if (mCircularBuffer != nullptr)
+            {
+                source = mCircularBuffer->getBuffer().data();
+                sourceSize = mCircularBuffer->getBuffer().size();
+                circular = true;
+            }
+            else if (mBuffer != nullptr && mChannel < mBuffer->getChannelCount() && mBuffer->getSize() > 0)
+            {
+                source = (*mBuffer)[mChannel].data();
+                sourceSize = mBuffer->getSize();
+            }
+
+            if (source == nullptr)
+            {
+                mPool.clear();
+                mSamplesUntilNextGrain = 0.0;
+                mTriggerCount.store(0);
+                std::memset(outputBuffer.data(), 0, sizeof(SampleValue) * outputBuffer.size());
+                return;
+            }
+
+            // Start the triggered grains at the start of the buffer
+            auto triggerCount = mTriggerCount.exchange(0);
+            for (auto i = 0; i < triggerCount; ++i)
+                startGrain(0, circular, sourceSize);
+
+            // Start the grains of the cloud at their exact offset within the buffer
+            auto density = mDensity.load();
+            if (density > 0.f)
+            {
+                double interval = getSampleRate() / density;
+                while (mSamplesUntilNextGrain < bufferSize)
+                {
+                    if (!startGrain(int(mSamplesUntilNextGrain), circular, sourceSize))
+                    {
+                        // The pool is full, skip the remaining grains of this buffer
+                        mSamplesUntilNextGrain = bufferSize;
+                        break;
+                    }
+                    mSamplesUntilNextGrain += interval;
+                }
+                mSamplesUntilNextGrain -= bufferSize;
+            }
+            else
+                mSamplesUntilNextGrain = 0.0;
+
+            mPool.process(source, sourceSize, circular, outputBuffer.data(), bufferSize, mWindow.load());
+        }
+
+
+        bool GrainCloudNode::startGrain(int delay, bool circular, int sourceSize)
+        {
+            const auto samplesPerMillisecond = getNodeManager().getSamplesPerMillisecond();
+            auto duration = int(mDuration.load() * samplesPerMillisecond);
+            auto speed = mSpeed.load() * (1.f + mSpeedJitter.load() * getRandom());
+            auto gain = mGain.load() * (1.f - mGainJitter.load() * 0.5f * (getRandom() + 1.f));
+            auto position = mPosition.load() + mPositionJitter.load() * getRandom();
+
+            double start = 0.0;
+            if (circular)
+            {
+                // As in CircularBufferPlayerNode one buffer size is added, to not start reading after the write position.
+                // The grain follows the write position until its delay has passed.
+                auto relativePosition = std::max(0.0, double(position) * samplesPerMillisecond);
+                auto wholeSamples = std::floor(relativePosition);
+                start = double(mCircularBuffer->getAbsolutePosition((unsigned int)wholeSamples + getBufferSize())) - (relativePosition - wholeSamples) + delay;
+            }
+            else {
+                start = double(position) * mBufferSampleRate / 1000.0;
+                speed *= mBufferSampleRate / getSampleRate();
+            }
+
+            return mPool.start(start, speed, gain, duration, delay);
+        }
+
+
+        float GrainCloudNode::getRandom()
+        {
+            // Xorshift, cheap and free of locks and allocations
+            mRandomState ^= mRandomState << 13;
+            mRandomState ^= mRandomState >> 17;
+            mRandomState ^= mRandomState << 5;
+            return mRandomState * (2.f / 4294967296.f) - 1.f;
+        }
+
+    }
+
+}
@@ -0,0 +1,149 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <atomic>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/node/circularbuffernode.h>
+#include <audio/utility/grainpool.h>
+#include <audio/utility/safeptr.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Granular synthesis node that plays a cloud of short grains from either a CircularBufferNode or a MultiSampleBuffer, for example from an AudioBufferResource.
+         * Grains are started at a given density with a duration, read position, speed and gain that can be randomized per grain.
+         * All grains are mixed by a GrainPool that is allocated on construction, so starting grains does not allocate and the cost per grain is a few operations per sample.
+         * When the pool is full new grains are skipped until playing grains have finished.
+         * All methods can be called from the control thread.
+         */
+        class NAPAPI GrainCloudNode : public Node
+        {
+            RTTI_ENABLE(Node)
+
+        public:
+            /**
+             * Constructor
+             * @param manager The node manager the node is processed on.
+             * @param maxGrainCount The maximum number of grains playing at the same time.
+             */
+            GrainCloudNode(NodeManager& manager, int maxGrainCount = 256);
+            ~GrainCloudNode() override;
+
+            /**
+             * The output with the sum of all the grains.
+             */
+            OutputPin audioOutput = { this };
+
+            /**
+             * Reads grains from a circular buffer. Grain positions are relative to the write position of the buffer.
+             * A circular buffer takes precedence over a buffer set with setBuffer(SafePtr<MultiSampleBuffer>, int, float). Pass nullptr to stop reading from it.
+             */
+            void setBuffer(CircularBufferNode* buffer);
+
+            /**
+             * Reads grains from one channel of a multichannel buffer. Grain positions are relative to the start of the buffer.
+             * @param buffer The buffer, pass nullptr to stop reading from it.
+             * @param channel The channel within the buffer.
+             * @param sampleRate Sample rate of the buffer, used to play it back at its original pitch at speed 1.
+             */
+            void setBuffer(SafePtr<MultiSampleBuffer> buffer, int channel, float sampleRate);
+
+            /**
+             * Sets the number of grains that are started per second. With a density of 0 grains are only started by trigger().
+             */
+            void setDensity(ControllerValue grainsPerSecond) { mDensity.store(grainsPerSecond); }
+
+            /**
+             * Sets the duration of new grains in milliseconds.
+             */
+            void setDuration(ControllerValue milliseconds) { mDuration.store(milliseconds); }
+
+            /**
+             * Sets the read position of new grains in milliseconds.
+             * For a circular buffer this is the time behind the write position, which has to be larger than the distance a grain travels towards the write position.
+             * For a MultiSampleBuffer it is the time from the start of the buffer.
+             */
+            void setPosition(ControllerValue milliseconds) { mPosition.store(milliseconds); }
+
+            /**
+             * Sets the maximum random deviation of the read position of new grains in milliseconds.
+             */
+            void setPositionJitter(ControllerValue milliseconds) { mPositionJitter.store(milliseconds); }
+
+            /**
+             * Sets the playback speed of new grains. Negative speeds play backwards.
+             */
+            void setSpeed(ControllerValue speed) { mSpeed.store(speed); }
+
+            /**
+             * Sets the maximum random deviation of the speed of new grains, as a fraction of the speed.
+             */
+            void setSpeedJitter(ControllerValue fraction) { mSpeedJitter.store(fraction); }
+
+            /**
+             * Sets the peak gain of new grains.
+             */
+            void setGain(ControllerValue gain) { mGain.store(gain); }
+
+            /**
+             * Sets the maximum random reduction of the gain of new grains, as a fraction of the gain.
+             */
+            void setGainJitter(ControllerValue fraction) { mGainJitter.store(fraction); }
+
+            /**
+             * Sets the window shape of all grains.
+             */
+            void setWindow(GrainWindow window) { mWindow.store(window); }
+
+            /**
+             * Starts one grain at the start of the next buffer, in addition to the grains started by the density.
+             */
+            void trigger() { mTriggerCount++; }
+
+            /**
+             * @return The maximum number of grains playing at the same time.
+             */
+            int getMaxGrainCount() const { return mPool.getMaxGrainCount(); }
+
+        private:
+            // Inherited from Node
+            void process() override;
+
+            bool startGrain(int delay, bool circular, int sourceSize); // Returns false if the pool is full
+            float getRandom(); // Returns a random value between -1 and 1
+
+            GrainPool mPool;
+            double mSamplesUntilNextGrain = 0.0;
+            unsigned int mRandomState = 1; // Seeded uniquely per node in the constructor
+
+            CircularBufferNode* mCircularBuffer = nullptr;
+            SafePtr<MultiSampleBuffer> mBuffer = nullptr;
+            int mChannel = 0;
+            float mBufferSampleRate = 44100.f;
+
+            std::atomic<CircularBufferNode*> mNewCircularBuffer = { nullptr };
+            std::atomic<ControllerValue> mDensity = { 0.f };
+            std::atomic<ControllerValue> mDuration = { 50.f };
+            std::atomic<ControllerValue> mPosition = { 100.f };
+            std::atomic<ControllerValue> mPositionJitter = { 0.f };
+            std::atomic<ControllerValue> mSpeed = { 1.f };
+            std::atomic<ControllerValue> mSpeedJitter = { 0.f };
+            std::atomic<ControllerValue> mGain = { 1.f };
+            std::atomic<ControllerValue> mGainJitter = { 0.f };
+            std::atomic<GrainWindow> mWindow = { GrainWindow::Hann };
+            std::atomic<int> mTriggerCount = { 0 };
+        };
+
+    }
+
+}
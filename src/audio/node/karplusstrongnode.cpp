@@ -4,6 +4,9 @@
 
 #include "karplusstrongnode.h"
 
+// Audio includes
+#include <audio/utility/nodeprofiler.h>
+
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::KarplusStrongNode)
 		RTTI_PROPERTY("input", &nap::audio::KarplusStrongNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
 		RTTI_PROPERTY("output", &nap::audio::KarplusStrongNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
@@ -19,10 +22,17 @@ namespace nap
     namespace audio
     {
 
+        KarplusStrongNode::~KarplusStrongNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
         void KarplusStrongNode::process()
         {
-            auto& outputBuffer = getOutputBuffer(audioOutput);
             auto inputBuffer = audioInput.pull();
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(audioOutput);
             if (mNegativePolarity)
                 for (auto i = 0; i < getBufferSize(); ++i)
                     outputBuffer[i] = mLowCut.process(mKarplusStrong.processNegative((*inputBuffer)[i]));
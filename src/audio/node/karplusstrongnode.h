@@ -27,6 +27,7 @@ namespace nap
 				reset(1000.f);
                 mLowCut.setCutoffFrequency(20.f, nodeManager.getSampleRate());
 			}
+			~KarplusStrongNode() override;
 
 			/**
 			 * Reset the filter and zeros the buffers.
@@ -0,0 +1,123 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
+#include <audio/utility/vectorextension.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Node that processes up to four or eight mono channels in the lanes of one vector with a single kernel.
+         * The kernel is a class template on the vector type with a method real process(const real& input), for example OnePoleLowPass or BiquadFilter.
+         * The inputs are interleaved into vectors when they are pulled and the outputs are de-interleaved when they are written, all processing in between is done with vector operations.
+         * Used by LanePackedObject to process multichannel signals with SIMD without rewriting the DSP per effect.
+         * @tparam Kernel Class template of the kernel.
+         * @tparam real float4 or float8, determines the number of lanes.
+         */
+        template <template <typename> class Kernel, typename real = float8>
+        class NAPAPI LanePackedNode : public Node
+        {
+            RTTI_ENABLE(Node)
+
+        public:
+            static constexpr int laneCount = sizeof(real) / sizeof(float); ///< Number of channels processed by the node.
+
+            LanePackedNode(NodeManager& nodeManager) : Node(nodeManager)
+            {
+                for (auto lane = 0; lane < laneCount; ++lane)
+                {
+                    mInputs.emplace_back(std::make_unique<InputPin>(this));
+                    mOutputs.emplace_back(std::make_unique<OutputPin>(this));
+                }
+                mInterleaved.resize(getBufferSize() * laneCount, 0.f);
+            }
+
+            ~LanePackedNode() override { NAP_AUDIO_NODE_RELEASE(); }
+
+            /**
+             * @return The input pin of a lane. Unconnected inputs are processed as silence.
+             */
+            InputPin& getInput(int lane) { return *mInputs[lane]; }
+
+            /**
+             * @return The output pin of a lane.
+             */
+            OutputPin& getOutput(int lane) { return *mOutputs[lane]; }
+
+            /**
+             * Changes the kernel. The function is called on the audio thread before the next buffer is processed.
+             * @param function Function that takes a reference to the kernel.
+             */
+            template <typename Function>
+            void update(Function function)
+            {
+                getNodeManager().enqueueTask([&, function](){ function(mKernel); });
+            }
+
+        protected:
+            /**
+             * @return The kernel, can only be used on the audio thread.
+             */
+            Kernel<real>& getKernel() { return mKernel; }
+
+            // Inherited from Node
+            void process() override
+            {
+                SampleBuffer* inputs[laneCount];
+                for (auto lane = 0; lane < laneCount; ++lane)
+                    inputs[lane] = mInputs[lane]->pull();
+
+                NAP_AUDIO_NODE_SCOPE();
+                auto size = getBufferSize();
+
+                for (auto lane = 0; lane < laneCount; ++lane)
+                {
+                    auto input = inputs[lane];
+                    for (auto i = 0; i < size; ++i)
+                        mInterleaved[i * laneCount + lane] = (input != nullptr) ? (*input)[i] : 0.f;
+                }
+
+                for (auto i = 0; i < size; ++i)
+                {
+                    real value = mKernel.process(real(&mInterleaved[i * laneCount]));
+                    std::memcpy(&mInterleaved[i * laneCount], &value, sizeof(real));
+                }
+
+                for (auto lane = 0; lane < laneCount; ++lane)
+                {
+                    auto& outputBuffer = getOutputBuffer(*mOutputs[lane]);
+                    for (auto i = 0; i < size; ++i)
+                        outputBuffer[i] = mInterleaved[i * laneCount + lane];
+                }
+            }
+
+            void bufferSizeChanged(int bufferSize) override
+            {
+                mInterleaved.resize(bufferSize * laneCount, 0.f);
+            }
+
+        private:
+            Kernel<real> mKernel;
+            std::vector<std::unique_ptr<InputPin>> mInputs;
+            std::vector<std::unique_ptr<OutputPin>> mOutputs;
+            std::vector<float> mInterleaved; // One buffer of frames of laneCount samples
+        };
+
+    }
+
+}
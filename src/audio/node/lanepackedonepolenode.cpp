@@ -0,0 +1,68 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "lanepackedonepolenode.h"
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::LanePackedNode<nap::audio::OnePoleLowPass>)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::LanePackedNode<nap::audio::OnePoleHighPass>)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::LanePackedLowPassNode)
+    RTTI_FUNCTION("setCutoffFrequency", &nap::audio::LanePackedLowPassNode::setCutoffFrequency)
+    RTTI_FUNCTION("getCutoffFrequency", &nap::audio::LanePackedLowPassNode::getCutoffFrequency)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::LanePackedHighPassNode)
+    RTTI_FUNCTION("setCutoffFrequency", &nap::audio::LanePackedHighPassNode::setCutoffFrequency)
+    RTTI_FUNCTION("getCutoffFrequency", &nap::audio::LanePackedHighPassNode::getCutoffFrequency)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        LanePackedLowPassNode::LanePackedLowPassNode(NodeManager& nodeManager) : LanePackedNode<OnePoleLowPass>(nodeManager)
+        {
+            getKernel().setCutoffFrequency(mCutoff, nodeManager.getSampleRate());
+        }
+
+
+        void LanePackedLowPassNode::setCutoffFrequency(ControllerValue frequency)
+        {
+            mCutoff = frequency;
+            update([&, frequency](OnePoleLowPass<float8>& kernel){ kernel.setCutoffFrequency(frequency, getSampleRate()); });
+        }
+
+
+        void LanePackedLowPassNode::sampleRateChanged(float sampleRate)
+        {
+            getKernel().setCutoffFrequency(mCutoff, sampleRate);
+        }
+
+
+        LanePackedHighPassNode::LanePackedHighPassNode(NodeManager& nodeManager) : LanePackedNode<OnePoleHighPass>(nodeManager)
+        {
+            getKernel().setCutoffFrequency(mCutoff, nodeManager.getSampleRate());
+        }
+
+
+        void LanePackedHighPassNode::setCutoffFrequency(ControllerValue frequency)
+        {
+            mCutoff = frequency;
+            update([&, frequency](OnePoleHighPass<float8>& kernel){ kernel.setCutoffFrequency(frequency, getSampleRate()); });
+        }
+
+
+        void LanePackedHighPassNode::sampleRateChanged(float sampleRate)
+        {
+            getKernel().setCutoffFrequency(mCutoff, sampleRate);
+        }
+
+    }
+
+}
@@ -0,0 +1,74 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Audio includes
+#include <audio/node/lanepackednode.h>
+#include <audio/utility/onepole.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * One pole lowpass filter on eight channels at once, see LanePackedNode.
+         */
+        class NAPAPI LanePackedLowPassNode : public LanePackedNode<OnePoleLowPass>
+        {
+            RTTI_ENABLE(LanePackedNode<OnePoleLowPass>)
+
+        public:
+            LanePackedLowPassNode(NodeManager& nodeManager);
+
+            /**
+             * Sets the cutoff frequency of the filters on all lanes.
+             * @param frequency Cutoff frequency in Hz
+             */
+            void setCutoffFrequency(ControllerValue frequency);
+
+            /**
+             * @return the cutoff frequency in Hz
+             */
+            ControllerValue getCutoffFrequency() const { return mCutoff; }
+
+        private:
+            void sampleRateChanged(float sampleRate) override;
+
+            std::atomic<ControllerValue> mCutoff = { 20000.f };
+        };
+
+
+        /**
+         * One pole highpass filter on eight channels at once, see LanePackedNode.
+         */
+        class NAPAPI LanePackedHighPassNode : public LanePackedNode<OnePoleHighPass>
+        {
+            RTTI_ENABLE(LanePackedNode<OnePoleHighPass>)
+
+        public:
+            LanePackedHighPassNode(NodeManager& nodeManager);
+
+            /**
+             * Sets the cutoff frequency of the filters on all lanes.
+             * @param frequency Cutoff frequency in Hz
+             */
+            void setCutoffFrequency(ControllerValue frequency);
+
+            /**
+             * @return the cutoff frequency in Hz
+             */
+            ControllerValue getCutoffFrequency() const { return mCutoff; }
+
+        private:
+            void sampleRateChanged(float sampleRate) override;
+
+            std::atomic<ControllerValue> mCutoff = { 20.f };
+        };
+
+    }
+
+}
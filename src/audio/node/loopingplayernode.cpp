@@ -0,0 +1,155 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "loopingplayernode.h"
+
+// Std includes
+#include <cstdint>
+#include <cstring>
+
+// Audio includes
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::LoopingPlayerNode)
+    RTTI_PROPERTY("audioOutput", &nap::audio::LoopingPlayerNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_FUNCTION("stop", &nap::audio::LoopingPlayerNode::stop)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        LoopingPlayerNode::LoopingPlayerNode(NodeManager& manager, SafePtr<Translator<ControllerValue>> translator) : Node(manager), mTranslator(translator)
+        {
+        }
+
+
+        LoopingPlayerNode::~LoopingPlayerNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
+        void LoopingPlayerNode::play(SafePtr<MultiSampleBuffer> buffer, int channel, const Loop& loop, ControllerValue speed)
+        {
+            getNodeManager().enqueueTask([&, buffer, channel, loop, speed](){
+                mBuffer = buffer;
+                mChannel = channel;
+                mLoop = loop;
+                mSpeed = speed;
+                mPosition = loop.mStart;
+                mCrossFading = false;
+                mFadeOutLength = 0;
+                mFadeOutRemaining = 0;
+                mPlaying = true;
+            });
+        }
+
+
+        void LoopingPlayerNode::stop(TimeValue fadeOutTime)
+        {
+            getNodeManager().enqueueTask([&, fadeOutTime](){
+                int length = fadeOutTime * getNodeManager().getSamplesPerMillisecond();
+                if (length <= 0)
+                    mPlaying = false;
+                else if (mFadeOutLength == 0)
+                {
+                    mFadeOutLength = length;
+                    mFadeOutRemaining = length;
+                }
+                else if (length < mFadeOutRemaining)
+                {
+                    // Shorten the running fade from its current gain, scaling the length keeps the ratio of remaining to length so the gain never rises
+                    mFadeOutLength = int(int64_t(length) * mFadeOutLength / mFadeOutRemaining);
+                    mFadeOutRemaining = length;
+                }
+            });
+        }
+
+
+        void LoopingPlayerNode::process()
+        {
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(audioOutput);
+
+            if (mPlaying && (mBuffer == nullptr || mChannel >= mBuffer->getChannelCount()))
+                mPlaying = false;
+
+            if (!mPlaying)
+            {
+                std::memset(outputBuffer.data(), 0, sizeof(SampleValue) * outputBuffer.size());
+                return;
+            }
+
+            mData = (*mBuffer)[mChannel].data();
+            mSize = mBuffer->getSize();
+
+            const double fadeStart = mLoop.mLoopEnd - mLoop.mCrossFade;
+            for (auto i = 0; i < outputBuffer.size(); ++i)
+            {
+                if (!mPlaying)
+                {
+                    outputBuffer[i] = 0.f;
+                    continue;
+                }
+
+                if (mLoop.mLoop && !mCrossFading && mPosition >= fadeStart)
+                {
+                    // Start the second read position at the same distance from the loop start
+                    mFadePosition = mLoop.mLoopStart + (mPosition - fadeStart);
+                    mCrossFading = true;
+                }
+
+                float value = 0.f;
+                if (mCrossFading)
+                {
+                    float fade = (mLoop.mCrossFade > 0) ? float((mPosition - fadeStart) / mLoop.mCrossFade) : 1.f;
+                    if (fade >= 1.f)
+                    {
+                        // Crossfade finished, the second read position takes over
+                        mPosition = mFadePosition;
+                        mCrossFading = false;
+                        value = read(mPosition);
+                    }
+                    else
+                        value = read(mPosition) * translate(1.f - fade) + read(mFadePosition) * translate(fade);
+                }
+                else
+                    value = read(mPosition);
+
+                if (mFadeOutLength > 0)
+                {
+                    value *= translate(float(mFadeOutRemaining) / mFadeOutLength);
+                    if (--mFadeOutRemaining <= 0)
+                        mPlaying = false;
+                }
+
+                outputBuffer[i] = value;
+
+                mPosition += mSpeed;
+                if (mCrossFading)
+                    mFadePosition += mSpeed;
+                else if (mPosition >= mSize - 1)
+                    mPlaying = false;
+            }
+        }
+
+
+        float LoopingPlayerNode::read(double position) const
+        {
+            if (position < 0.0)
+                return 0.f;
+            auto index = DiscreteTimeValue(position);
+            if (index + 1 >= mSize)
+                return 0.f;
+            float fraction = float(position - index);
+            return mData[index] + fraction * (mData[index + 1] - mData[index]);
+        }
+
+    }
+
+}
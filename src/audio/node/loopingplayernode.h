@@ -0,0 +1,96 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/utility/audiotypes.h>
+#include <audio/utility/safeptr.h>
+#include <audio/utility/translator.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Plays back one channel of a MultiSampleBuffer and loops a section of it by crossfading from the end of the section to its start.
+         * The crossfade is done within the node with a second read position, sample accurately and with the curve of a translator, generally an EqualPowerTranslator.
+         * The crossfade starts when the read position reaches the loop end minus the crossfade length, at which point the second read position starts at the loop start.
+         * All methods can be called from the control thread, they are executed at the start of the next buffer.
+         */
+        class NAPAPI LoopingPlayerNode : public Node
+        {
+            RTTI_ENABLE(Node)
+
+        public:
+            /**
+             * Positions in samples within the buffer that describe the playback of a buffer.
+             */
+            struct Loop
+            {
+                DiscreteTimeValue mStart = 0;       ///< Position where playback starts.
+                DiscreteTimeValue mLoopStart = 0;   ///< Start of the looped section.
+                DiscreteTimeValue mLoopEnd = 0;     ///< End of the looped section.
+                DiscreteTimeValue mCrossFade = 0;   ///< Length of the crossfade from the end to the start of the looped section.
+                bool mLoop = true;                  ///< If false playback stops at the end of the buffer and the loop points are ignored.
+            };
+
+            /**
+             * Constructor
+             * @param manager The node manager the node is processed on.
+             * @param translator Translator that turns the linear crossfade into a gain curve, generally an EqualPowerTranslator. A linear crossfade is used when nullptr.
+             */
+            LoopingPlayerNode(NodeManager& manager, SafePtr<Translator<ControllerValue>> translator = nullptr);
+            ~LoopingPlayerNode() override;
+
+            /**
+             * The output with the played back audio.
+             */
+            OutputPin audioOutput = { this };
+
+            /**
+             * Starts playback, replacing the current playback without a fade.
+             * @param buffer The buffer to play.
+             * @param channel The channel within the buffer.
+             * @param loop The start and loop points in samples.
+             * @param speed Playback speed, has to be positive.
+             */
+            void play(SafePtr<MultiSampleBuffer> buffer, int channel, const Loop& loop, ControllerValue speed = 1.f);
+
+            /**
+             * Fades out and stops playback.
+             * @param fadeOutTime Fade out time in milliseconds, 0 stops immediately.
+             */
+            void stop(TimeValue fadeOutTime);
+
+        private:
+            // Inherited from Node
+            void process() override;
+
+            float read(double position) const;
+            float translate(float value) { return (mTranslator != nullptr) ? mTranslator->translate(value) : value; }
+
+            SafePtr<Translator<ControllerValue>> mTranslator = nullptr;
+            SafePtr<MultiSampleBuffer> mBuffer = nullptr;
+            int mChannel = 0;
+            const SampleValue* mData = nullptr;     // Channel data of the buffer, updated every buffer
+            DiscreteTimeValue mSize = 0;
+
+            Loop mLoop;
+            double mSpeed = 1.0;
+            double mPosition = 0.0;
+            double mFadePosition = 0.0;     // Position of the second read position during the crossfade
+            bool mCrossFading = false;
+            bool mPlaying = false;
+
+            int mFadeOutLength = 0;         // Length of the fade out in samples, 0 if not fading out
+            int mFadeOutRemaining = 0;
+        };
+
+    }
+
+}
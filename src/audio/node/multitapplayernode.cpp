@@ -0,0 +1,158 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "multitapplayernode.h"
+
+// Std includes
+#include <cstring>
+
+// Nap includes
+#include <nap/logger.h>
+
+// Audio includes
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
+
+RTTI_BEGIN_ENUM(nap::audio::TapInterpolation)
+    RTTI_ENUM_VALUE(nap::audio::TapInterpolation::Linear, "Linear"),
+    RTTI_ENUM_VALUE(nap::audio::TapInterpolation::Hermite, "Hermite"),
+    RTTI_ENUM_VALUE(nap::audio::TapInterpolation::Sinc, "Sinc")
+RTTI_END_ENUM
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::MultiTapPlayerNode)
+    RTTI_PROPERTY("audioOutput", &nap::audio::MultiTapPlayerNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_FUNCTION("setTapCount", &nap::audio::MultiTapPlayerNode::setTapCount)
+    RTTI_FUNCTION("startTap", &nap::audio::MultiTapPlayerNode::startTap)
+    RTTI_FUNCTION("setSpeed", &nap::audio::MultiTapPlayerNode::setSpeed)
+    RTTI_FUNCTION("setGain", &nap::audio::MultiTapPlayerNode::setGain)
+    RTTI_FUNCTION("setInterpolation", &nap::audio::MultiTapPlayerNode::setInterpolation)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        MultiTapPlayerNode::MultiTapPlayerNode(NodeManager& manager, int maxTapCount) : Node(manager), mReader(maxTapCount), mCommands(4 * maxTapCount)
+        {
+        }
+
+
+        MultiTapPlayerNode::~MultiTapPlayerNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
+        void MultiTapPlayerNode::setBuffer(CircularBufferNode* buffer)
+        {
+            mNewBuffer.store(buffer);
+        }
+
+
+        void MultiTapPlayerNode::setTapCount(int count)
+        {
+            Command command;
+            command.mType = Command::Type::TapCount;
+            command.mTap = count;
+            enqueue(command);
+        }
+
+
+        void MultiTapPlayerNode::startTap(int tap, int relativePosition, ControllerValue speed, ControllerValue gain)
+        {
+            if (tap < 0 || tap >= getMaxTapCount())
+                return;
+
+            Command command;
+            command.mType = Command::Type::Start;
+            command.mTap = tap;
+            command.mRelativePosition = relativePosition;
+            command.mSpeed = speed;
+            command.mGain = gain;
+            enqueue(command);
+        }
+
+
+        void MultiTapPlayerNode::setSpeed(int tap, ControllerValue speed)
+        {
+            if (tap < 0 || tap >= getMaxTapCount())
+                return;
+
+            Command command;
+            command.mType = Command::Type::Speed;
+            command.mTap = tap;
+            command.mSpeed = speed;
+            enqueue(command);
+        }
+
+
+        void MultiTapPlayerNode::setGain(int tap, ControllerValue gain)
+        {
+            if (tap < 0 || tap >= getMaxTapCount())
+                return;
+
+            Command command;
+            command.mType = Command::Type::Gain;
+            command.mTap = tap;
+            command.mGain = gain;
+            enqueue(command);
+        }
+
+
+        void MultiTapPlayerNode::enqueue(const Command& command)
+        {
+            if (!mCommands.try_enqueue(command))
+                Logger::warn("MultiTapPlayerNode: command queue is full, command dropped");
+        }
+
+
+        void MultiTapPlayerNode::process()
+        {
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(audioOutput);
+
+            mBuffer = mNewBuffer.load();
+
+            Command command;
+            while (mCommands.try_dequeue(command))
+            {
+                switch (command.mType)
+                {
+                    case Command::Type::Start:
+                        if (mBuffer != nullptr)
+                        {
+                            // As in CircularBufferPlayerNode one buffer size is added, to not start reading after the write position.
+                            auto position = mBuffer->getAbsolutePosition(command.mRelativePosition + getBufferSize());
+                            mReader.setPosition(command.mTap, double(position), mBuffer->getBuffer().size());
+                        }
+                        mReader.setSpeed(command.mTap, command.mSpeed);
+                        mReader.setGain(command.mTap, command.mGain);
+                        break;
+                    case Command::Type::Speed:
+                        mReader.setSpeed(command.mTap, command.mSpeed);
+                        break;
+                    case Command::Type::Gain:
+                        mReader.setGain(command.mTap, command.mGain);
+                        break;
+                    case Command::Type::TapCount:
+                        mReader.setTapCount(command.mTap);
+                        break;
+                }
+            }
+
+            if (mBuffer == nullptr || mReader.getTapCount() == 0)
+            {
+                std::memset(outputBuffer.data(), 0, sizeof(SampleValue) * outputBuffer.size());
+                return;
+            }
+
+            auto& source = mBuffer->getBuffer();
+            mReader.process(source.data(), source.size(), outputBuffer.data(), outputBuffer.size(), mInterpolation.load());
+        }
+
+    }
+
+}
@@ -0,0 +1,114 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <atomic>
+
+// Nap includes
+#include <utility/threading.h>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/node/circularbuffernode.h>
+#include <audio/utility/multitapreader.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Plays back a number of taps from one circular buffer in a single pass and outputs their sum.
+         * Each tap has its own position, speed and gain. This replaces a CircularBufferPlayerNode per tap for echo and granular effects.
+         * The interpolation between samples can be chosen at runtime, see TapInterpolation.
+         * All methods can be called from the control thread, changes are passed to the audio thread through a lock free queue and applied at the start of the next buffer.
+         */
+        class NAPAPI MultiTapPlayerNode : public Node
+        {
+            RTTI_ENABLE(Node)
+
+        public:
+            /**
+             * Constructor
+             * @param manager The node manager the node is processed on.
+             * @param maxTapCount The maximum number of taps.
+             */
+            MultiTapPlayerNode(NodeManager& manager, int maxTapCount = 32);
+            ~MultiTapPlayerNode() override;
+
+            /**
+             * The output with the sum of all the taps.
+             */
+            OutputPin audioOutput = { this };
+
+            /**
+             * Sets the circular buffer the taps read from. Pass nullptr to stop playback.
+             */
+            void setBuffer(CircularBufferNode* buffer);
+
+            /**
+             * Sets the number of taps that are played. Is clamped to the maximum number of taps.
+             */
+            void setTapCount(int count);
+
+            /**
+             * Starts a tap at a position relative to the write position of the circular buffer.
+             * @param tap Index of the tap.
+             * @param relativePosition Starting position in samples behind the write position of the buffer.
+             * @param speed Playback speed, 1.0 means 1 sample per sample. Negative speeds play backwards.
+             * @param gain Gain the tap is mixed into the output with.
+             */
+            void startTap(int tap, int relativePosition, ControllerValue speed = 1.f, ControllerValue gain = 1.f);
+
+            /**
+             * Changes the speed of a tap without changing its position.
+             */
+            void setSpeed(int tap, ControllerValue speed);
+
+            /**
+             * Changes the gain of a tap.
+             */
+            void setGain(int tap, ControllerValue gain);
+
+            /**
+             * Sets the interpolation used to read between samples.
+             */
+            void setInterpolation(TapInterpolation interpolation) { mInterpolation.store(interpolation); }
+
+            /**
+             * @return The maximum number of taps.
+             */
+            int getMaxTapCount() const { return mReader.getMaxTapCount(); }
+
+        private:
+            struct Command
+            {
+                enum class Type { Start, Speed, Gain, TapCount };
+
+                Type mType = Type::Start;
+                int mTap = 0;
+                int mRelativePosition = 0;
+                ControllerValue mSpeed = 1.f;
+                ControllerValue mGain = 1.f;
+            };
+
+            // Inherited from Node
+            void process() override;
+
+            void enqueue(const Command& command);
+
+            MultiTapReader mReader;
+            CircularBufferNode* mBuffer = nullptr;
+
+            std::atomic<CircularBufferNode*> mNewBuffer = { nullptr };
+            std::atomic<TapInterpolation> mInterpolation = { TapInterpolation::Linear };
+            moodycamel::ReaderWriterQueue<Command> mCommands;
+        };
+
+    }
+
+}
@@ -4,11 +4,21 @@
 
 #include "noisenode.h"
 
-// Std includes
-#include <stdlib.h>
+// Audio includes
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
+
+RTTI_BEGIN_ENUM(nap::audio::NoiseColor)
+    RTTI_ENUM_VALUE(nap::audio::NoiseColor::White, "White"),
+    RTTI_ENUM_VALUE(nap::audio::NoiseColor::Pink, "Pink"),
+    RTTI_ENUM_VALUE(nap::audio::NoiseColor::Brown, "Brown")
+RTTI_END_ENUM
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::NoiseNode)
     RTTI_PROPERTY("audioOutput", &nap::audio::NoiseNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_FUNCTION("setColor", &nap::audio::NoiseNode::setColor)
+    RTTI_FUNCTION("setBipolar", &nap::audio::NoiseNode::setBipolar)
+    RTTI_FUNCTION("setSeed", &nap::audio::NoiseNode::setSeed)
 RTTI_END_CLASS
 
 namespace nap
@@ -16,12 +26,43 @@ namespace nap
     
     namespace audio
     {
+
+        /**
+         * Returns a different seed for every call, so that nodes without an explicit seed are not correlated.
+         */
+        static uint32_t getUniqueSeed()
+        {
+            static std::atomic<uint32_t> counter = { 0 };
+            return ++counter;
+        }
+
+
+        NoiseNode::NoiseNode(NodeManager& manager, uint32_t seed) : Node(manager), mGenerator((seed != 0) ? seed : getUniqueSeed())
+        {
+        }
+
+
+        NoiseNode::~NoiseNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
+        void NoiseNode::setSeed(uint32_t seed)
+        {
+            getNodeManager().enqueueTask([&, seed](){ mGenerator.setSeed(seed); });
+        }
+
         
         void NoiseNode::process()
         {
+            NAP_AUDIO_NODE_SCOPE();
             auto& buffer = getOutputBuffer(audioOutput);
-            for (auto i = 0; i < buffer.size(); ++i)
-                buffer[i] = rand() / float(RAND_MAX);
+            mGenerator.process(buffer.data(), buffer.size(), mColor.load());
+
+            if (!mBipolar.load())
+                for (auto i = 0; i < buffer.size(); ++i)
+                    buffer[i] = 0.5f * buffer[i] + 0.5f;
         }
         
     }
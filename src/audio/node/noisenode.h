@@ -4,7 +4,12 @@
 
 #pragma once
 
+// Std includes
+#include <atomic>
+
+// Audio includes
 #include <audio/core/audionode.h>
+#include <audio/utility/noisegenerator.h>
 
 namespace nap
 {
@@ -13,20 +18,49 @@ namespace nap
     {
         
         /**
-         * White noise generator
+         * Noise generator with a white, pink or brown spectrum, see NoiseGenerator.
+         * The output is between 0 and 1 by default, or between -1 and 1 when bipolar.
          */
         class NAPAPI NoiseNode : public Node
         {
+            RTTI_ENABLE(Node)
+
         public:
-            NoiseNode(NodeManager& manager) : Node(manager) { }
+            /**
+             * Constructor
+             * @param manager The node manager the node is processed on.
+             * @param seed Seed of the generator. With 0 every node gets a different seed.
+             */
+            NoiseNode(NodeManager& manager, uint32_t seed = 0);
+            ~NoiseNode() override;
         
             /**
              * Output signal containing the noise
              */
             OutputPin audioOutput = { this };
+
+            /**
+             * Sets the spectrum of the noise.
+             */
+            void setColor(NoiseColor color) { mColor.store(color); }
+
+            /**
+             * Sets whether the output is between -1 and 1 instead of between 0 and 1.
+             */
+            void setBipolar(bool bipolar) { mBipolar.store(bipolar); }
+
+            /**
+             * Restarts the generator from a seed at the start of the next buffer.
+             * @param seed Seed of the generator, nodes with the same seed and settings produce the same output.
+             */
+            void setSeed(uint32_t seed);
             
         private:
             void process() override;
+
+            NoiseGenerator mGenerator;
+            std::atomic<NoiseColor> mColor = { NoiseColor::White };
+            std::atomic<bool> mBipolar = { false };
         };
         
     }
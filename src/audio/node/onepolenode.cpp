@@ -6,6 +6,7 @@
 
 #include <audio/core/audionodemanager.h>
 #include <audio/utility/audiofunctions.h>
+#include <audio/utility/nodeprofiler.h>
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::OnePoleLowPassNode)
     RTTI_FUNCTION("setCutoffFrequency", &nap::audio::OnePoleLowPassNode::setCutoffFrequency)
@@ -25,10 +26,17 @@ namespace nap
         
         // --- Low pass --- //
         
+        OnePoleLowPassNode::~OnePoleLowPassNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
         void OnePoleLowPassNode::process()
         {
-            auto& outputBuffer = getOutputBuffer(output);
             auto& inputBuffer = *input.pull();
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(output);
             
             for (auto i = 0; i < outputBuffer.size(); ++i)
             {
@@ -58,10 +66,17 @@ namespace nap
         
         // --- High pass --- //
         
+        OnePoleHighPassNode::~OnePoleHighPassNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
         void OnePoleHighPassNode::process()
         {
-            auto& outputBuffer = getOutputBuffer(output);
             auto& inputBuffer = *input.pull();
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(output);
             
             for (auto i = 0; i < outputBuffer.size(); ++i)
             {
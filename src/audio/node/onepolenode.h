@@ -22,6 +22,7 @@ namespace nap
             RTTI_ENABLE(Node)
         public:
             OnePoleLowPassNode(NodeManager& nodeManager) : Node(nodeManager) { }
+            ~OnePoleLowPassNode() override;
             
             InputPin input = { this };     ///< Audio input pin
             OutputPin output = { this };   ///< Audio output pin
@@ -60,6 +61,7 @@ namespace nap
             RTTI_ENABLE(Node)
         public:
             OnePoleHighPassNode(NodeManager& nodeManager) : Node(nodeManager) { }
+            ~OnePoleHighPassNode() override;
             
             InputPin input = { this };     ///< Audio input pin
             OutputPin output = { this };   ///< Audio output pin
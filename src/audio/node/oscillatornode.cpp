@@ -6,13 +6,23 @@
 
 #include <math.h>
 
+// Std includes
+#include <algorithm>
+#include <complex>
+#include <map>
+#include <mutex>
+#include <tuple>
+
 // Rtti includes
 #include <rtti/rtti.h>
 
 // Audio includes
 #include <audio/utility/audiofunctions.h>
 #include <audio/utility/safeptr.h>
+#include <audio/utility/bufferstate.h>
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
+#include <audio/utility/vectorkernels.h>
 
 RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::OscillatorNode)
     RTTI_FUNCTION("setFrequency", &nap::audio::OscillatorNode::setFrequency)
@@ -30,56 +40,176 @@ namespace nap
         
 // --- Wavetable --- //
 
+        /**
+         * In place radix 2 inverse fast fourier transform without normalization.
+         * @param data The spectrum on input and the signal on output, the size has to be a power of two.
+         */
+        static void inverseFourierTransform(std::vector<std::complex<double>>& data)
+        {
+            const double pi = 3.14159265358979323846;
+            const auto size = data.size();
+
+            // Bit reversal permutation
+            for (auto i = 1, j = 0; i < size; ++i)
+            {
+                auto bit = size >> 1;
+                for (; j & bit; bit >>= 1)
+                    j ^= bit;
+                j ^= bit;
+                if (i < j)
+                    std::swap(data[i], data[j]);
+            }
+
+            // Butterflies
+            for (auto length = 2; length <= size; length <<= 1)
+            {
+                auto rotation = std::polar(1.0, 2.0 * pi / length);
+                for (auto start = 0; start < size; start += length)
+                {
+                    std::complex<double> twiddle = 1.0;
+                    for (auto k = 0; k < length / 2; ++k)
+                    {
+                        auto even = data[start + k];
+                        auto odd = data[start + k + length / 2] * twiddle;
+                        data[start + k] = even + odd;
+                        data[start + k + length / 2] = even - odd;
+                        twiddle *= rotation;
+                    }
+                }
+            }
+        }
+
+
 		WaveTable::WaveTable(long size, Waveform waveform, int numberOfBands)
         {
-			if (waveform == Waveform::Sine)
-			{
-				mData.resize(1, size);
-				mBandBottoms.emplace_back(0);
-				auto& bandData = mData[0];
-				auto step = math::PIX2 / size;
-				for (int i = 0; i < size; i++)
-					bandData[i] = sin(i * step);
-			}
-			else {
-				auto bandWidth = log2f(Nyquist) / numberOfBands;
-				mData.resize(numberOfBands, size);
-				mBandBottoms.resize(numberOfBands);
-				for (auto band = 0; band < numberOfBands; ++band)
-				{
-					auto bandFrequency = pow(2.f, bandWidth * band);
-					mBandBottoms[band] = bandFrequency;
-					auto& bandData = mData[band];
-
-					auto harmonic = 1;
-					bool negative = false;
-					while (bandFrequency * harmonic < Nyquist)
-					{
-						auto step = math::PIX2 / size;
-						auto a = harmonic > 1.f ? 1.f / (waveform == Waveform::Triangle ? pow(harmonic, 2) : harmonic - 1.f) : 1.f;
-						if (negative)
-							a *= -1.f;
-						for (auto i = 0; i < size; i++)
-							bandData[i] += a * sin(i * step * harmonic);
-						harmonic++;
-						if (waveform == Waveform::Square)
-							harmonic++;
-						else if (waveform == Waveform::Triangle)
-						{
-							harmonic++;
-							negative = !negative;
-						}
-					}
-				}
-			}
+            mBands = getBands(size, waveform, numberOfBands);
+        }
+
+
+        std::shared_ptr<const WaveTable::Bands> WaveTable::getBands(long size, Waveform waveform, int numberOfBands)
+        {
+            // A sine only has one band
+            if (waveform == Waveform::Sine)
+                numberOfBands = 1;
+
+            // Entries expire when the last wave table using them is destroyed
+            static std::mutex mutex;
+            static std::map<std::tuple<long, Waveform, int>, std::weak_ptr<const Bands>> cache;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& entry = cache[std::make_tuple(size, waveform, numberOfBands)];
+            auto bands = entry.lock();
+            if (bands == nullptr)
+            {
+                bands = createBands(size, waveform, numberOfBands);
+                entry = bands;
+            }
+            return bands;
+        }
+
+
+        std::shared_ptr<WaveTable::Bands> WaveTable::createBands(long size, Waveform waveform, int numberOfBands)
+        {
+            // Samples per cycle of the highest harmonic in a shortened table, keeps linear interpolation accurate
+            const int oversampling = 32;
+
+            auto bands = std::make_shared<Bands>();
+            bands->mSize = size;
+            auto step = math::PIX2 / size;
+
+            if (waveform == Waveform::Sine)
+            {
+                auto& table = bands->mTables.emplace_back(size);
+                for (int i = 0; i < size; i++)
+                    table[i] = sin(i * step);
+                bands->mBandBottoms.emplace_back(0);
+                bands->mBandTables.emplace_back(0);
+                bands->mBandScales.emplace_back(1.0);
+                return bands;
+            }
+
+            // Calls function(harmonic, amplitude) for all harmonics of the waveform below the limit
+            auto forEachHarmonic = [waveform](float limit, auto function) {
+                auto harmonic = 1;
+                bool negative = false;
+                while (harmonic < limit)
+                {
+                    auto a = harmonic > 1.f ? 1.f / (waveform == Waveform::Triangle ? pow(harmonic, 2) : harmonic - 1.f) : 1.f;
+                    function(harmonic, negative ? -a : a);
+                    harmonic++;
+                    if (waveform == Waveform::Square)
+                        harmonic++;
+                    else if (waveform == Waveform::Triangle)
+                    {
+                        harmonic++;
+                        negative = !negative;
+                    }
+                }
+            };
+
+            auto bandWidth = log2f(Nyquist) / numberOfBands;
+            const bool powerOfTwo = (size & (size - 1)) == 0;
+            std::vector<std::complex<double>> spectrum;
+            int previousHighest = 0;
+
+            for (auto band = 0; band < numberOfBands; ++band)
+            {
+                auto bandFrequency = pow(2.f, bandWidth * band);
+                bands->mBandBottoms.emplace_back(bandFrequency);
+
+                // Harmonics that do not fit in the table would alias within the table itself
+                auto limit = std::min(Nyquist / bandFrequency, size / 2.f);
+                int highest = 0;
+                forEachHarmonic(limit, [&](int harmonic, float) { highest = harmonic; });
+
+                // Bands are ascending, so bands with the same harmonics are adjacent
+                if (highest == previousHighest)
+                {
+                    bands->mBandTables.emplace_back(bands->mBandTables.back());
+                    bands->mBandScales.emplace_back(bands->mBandScales.back());
+                    continue;
+                }
+                previousHighest = highest;
+
+                long tableSize = size;
+                if (powerOfTwo)
+                    while (tableSize / 2 >= (highest + 1) * oversampling)
+                        tableSize /= 2;
+
+                bands->mBandTables.emplace_back(bands->mTables.size());
+                bands->mBandScales.emplace_back(double(tableSize) / size);
+                auto& table = bands->mTables.emplace_back(tableSize, 0.f);
+
+                if (powerOfTwo)
+                {
+                    // A sine with amplitude a is the sum of two complex exponentials with amplitude a / 2
+                    spectrum.assign(tableSize, 0.0);
+                    forEachHarmonic(limit, [&](int harmonic, float a) {
+                        spectrum[harmonic] += std::complex<double>(0.0, -0.5 * a);
+                        spectrum[tableSize - harmonic] += std::complex<double>(0.0, 0.5 * a);
+                    });
+                    inverseFourierTransform(spectrum);
+                    for (auto i = 0; i < tableSize; i++)
+                        table[i] = spectrum[i].real();
+                }
+                else {
+                    forEachHarmonic(limit, [&](int harmonic, float a) {
+                        for (auto i = 0; i < tableSize; i++)
+                            table[i] += a * sin(i * step * harmonic);
+                    });
+                }
+            }
+
+            return bands;
         }
 
 
         void WaveTable::normalize()
         {
-			for (auto band = 0; band < mData.getChannelCount(); band++)
+            // Normalize a copy, the bands may be shared with other wave tables
+            auto bands = std::make_shared<Bands>(*mBands);
+			for (auto& bandData : bands->mTables)
 			{
-				auto& bandData = mData[band];
 				SampleValue max, min;
 				max = min = bandData[0];
 
@@ -92,18 +222,21 @@ namespace nap
 				for(int i = 0; i < bandData.size(); i++)
 					bandData[i] /= max;
 			}
+            mBands = bands;
         }
 
         
         SampleValue WaveTable::interpolate(double index, float frequency) const
         {
+			// First band with a bottom frequency of at least the frequency, or the highest band
+			auto& bandBottoms = mBands->mBandBottoms;
+			auto band = std::min<long>(std::lower_bound(bandBottoms.begin(), bandBottoms.end(), frequency) - bandBottoms.begin(), bandBottoms.size() - 1);
+			auto& data = mBands->mTables[mBands->mBandTables[band]];
+
+            // Positions are given in the full size, shorter tables are read at a lower rate
+            index *= mBands->mBandScales[band];
             int floor = index;
             SampleValue frac = index - floor;
-
-			auto band = 0;
-			while (frequency > mBandBottoms[band] && band < mBandBottoms.size() - 1)
-				band++;
-			auto& data = mData.channels[band];
             
             auto v1 = data[wrap(floor, data.size())];
             auto v2 = data[wrap(floor + 1, data.size())];
@@ -118,6 +251,7 @@ namespace nap
         OscillatorNode::OscillatorNode(NodeManager& manager) : Node(manager)
         {
             mAmplitude.setStepCount(getNodeManager().getSamplesPerMillisecond());
+            mFmBuffer.resize(getBufferSize(), 0.f);
         }
 
 
@@ -126,13 +260,44 @@ namespace nap
         {
             mStep = mWave->getSize() / getNodeManager().getSampleRate();
             mAmplitude.setStepCount(getNodeManager().getSamplesPerMillisecond());
+            mFmBuffer.resize(getBufferSize(), 0.f);
+        }
+
+
+        OscillatorNode::~OscillatorNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
         }
 
         
         void OscillatorNode::process()
         {
-            auto& outputBuffer = getOutputBuffer(output);
             SampleBuffer* fmInputBuffer = fmInput.pull();
+            auto fmControlBuffer = fmControlInput.pull();
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(output);
+
+            // A silent or constant fm input, for example from a finished envelope or a static control, is applied as a single factor.
+            auto fmFactor = 1.f;
+            SampleValue fmValue = 0.f;
+            if (fmInputBuffer && getBufferState(*fmInputBuffer, fmValue) != BufferState::Varying)
+            {
+                fmFactor += fmValue;
+                fmInputBuffer = nullptr;
+            }
+
+            // Interpolate the control rate fm input and combine it with the audio rate fm input.
+            if (fmControlBuffer != nullptr)
+            {
+                if (fmControlBuffer->isConstant())
+                    fmFactor += fmControlBuffer->getEndValue();
+                else {
+                    fmControlBuffer->render(mFmBuffer.data());
+                    if (fmInputBuffer)
+                        getVectorKernels().mix(mFmBuffer.data(), fmInputBuffer->data(), 1.f, getBufferSize());
+                    fmInputBuffer = &mFmBuffer;
+                }
+            }
 
             if (mWave == nullptr)
             {
@@ -154,9 +319,9 @@ namespace nap
 
 				// calculate new phase
 				if (fmInputBuffer)
-                    mPhase += ((*fmInputBuffer)[i] + 1) * frequency * step;
+                    mPhase += ((*fmInputBuffer)[i] + fmFactor) * frequency * step;
                 else
-                    mPhase += frequency * step;
+                    mPhase += fmFactor * frequency * step;
                 if (mPhase > waveSize)
                     mPhase -= waveSize;
                 
@@ -197,5 +362,11 @@ namespace nap
         {
             mStep = mWave->getSize() / sampleRate;
         }
+
+
+        void OscillatorNode::bufferSizeChanged(int bufferSize)
+        {
+            mFmBuffer.resize(bufferSize, 0.f);
+        }
     }
 }
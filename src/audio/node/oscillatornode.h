@@ -6,8 +6,10 @@
 
 // Std includes
 #include <atomic>
+#include <memory>
 
 #include <audio/core/audionode.h>
+#include <audio/core/controlrate.h>
 #include <audio/utility/linearsmoothedvalue.h>
 #include <audio/utility/rampedvalue.h>
 #include <audio/utility/safeptr.h>
@@ -21,6 +23,8 @@ namespace nap
          * A wavetable that can be used as waveform data for an oscillator.
          * Contains a buffer with one cycle of samples for a periodic waveform.
          * The WaveTable also supports "bandlimited" data,  which means that different waveforms are used for different frequency bands to avoid aliasing in high frequencies.
+         * The bands are generated with an inverse FFT of their harmonic spectrum and shared between all wave tables with the same size, waveform and number of bands.
+         * Bands with the same harmonics share one table, and bands with fewer harmonics use shorter tables, so a waveform only takes a few hundred kilobytes at most.
          */
         class NAPAPI WaveTable
         {
@@ -31,13 +35,14 @@ namespace nap
         public:
             /**
              * Constructor takes the size of the waveform buffer and the waveform type.
-             * @param size Size of the waveform in samples
+             * @param size Size of the waveform in samples. Bands are generated fastest when this is a power of two.
              * @param waveform
              */
             WaveTable(long size, Waveform waveform = Waveform::Sine, int numberOfBands = 1);
             
             /**
              * Normalize the waveform so the "loudest" sample has amplitude 1.f
+             * The wave table stops sharing its bands with other wave tables.
              */
             void normalize();
             
@@ -51,12 +56,29 @@ namespace nap
             /**
              * @return the size of the waveform buffer
              */
-            long getSize() const { return mData.getSize(); }
+            long getSize() const { return mBands->mSize; }
+
+            /**
+             * @return The number of distinct tables that store the bands.
+             */
+            int getTableCount() const { return mBands->mTables.size(); }
             
         private:
-			using BandLimitedData = MultiSampleBuffer;
-            BandLimitedData mData;
-			std::vector<int> mBandBottoms;
+            // Band limited versions of the waveform, bands with the same harmonics share a table
+            struct Bands
+            {
+                long mSize = 0;                         // Size of one cycle that positions are given in
+                std::vector<SampleBuffer> mTables;      // Distinct tables, shorter for bands with fewer harmonics
+                std::vector<int> mBandBottoms;          // Frequency below which each band is used, ascending
+                std::vector<int> mBandTables;           // Index in mTables for each band
+                std::vector<double> mBandScales;        // Table size divided by mSize for each band
+            };
+
+            // Returns the bands from the cache, or generates them if no wave table with the same parameters exists
+            static std::shared_ptr<const Bands> getBands(long size, Waveform waveform, int numberOfBands);
+            static std::shared_ptr<Bands> createBands(long size, Waveform waveform, int numberOfBands);
+
+            std::shared_ptr<const Bands> mBands;
         };
 
         
@@ -74,6 +96,7 @@ namespace nap
              * Constructor takes the waveform of the oscillator.
              */
             OscillatorNode(NodeManager& aManager, SafePtr<WaveTable> wave);
+            ~OscillatorNode() override;
 
             /**
              * Set the frequency in Hz
@@ -103,11 +126,13 @@ namespace nap
             void setWave(SafePtr<WaveTable> aWave);
             
             InputPin fmInput = { this }; ///< Input pin to control frequency modulation.
+            ControlRateInputPin fmControlInput; ///< Control rate input pin to control frequency modulation. Is added to the signal on fmInput if both are connected.
             OutputPin output = { this }; ///< Audio output pin.
 
         private:
             void process() override;
             void sampleRateChanged(float sampleRate) override;
+            void bufferSizeChanged(int bufferSize) override;
 
             SafePtr<WaveTable> mWave = nullptr;
 
@@ -118,6 +143,7 @@ namespace nap
             std::atomic<ControllerValue> mPhaseOffset = { 0 };
             
             ControllerValue mPhase = 0;
+            SampleBuffer mFmBuffer; // Holds the control rate fm input interpolated to audio rate
         };
     }
 }
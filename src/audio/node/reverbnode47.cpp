@@ -8,7 +8,9 @@
 #include "reverbnode47.h"
 
 #include <audio/utility/audiofunctions.h>
+#include <audio/utility/denormals.h>
 #include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
 
 RTTI_BEGIN_STRUCT(nap::audio::verb47::ReverbSettings)
         RTTI_PROPERTY("InputAllPassDelays", &nap::audio::verb47::ReverbSettings::mInputAllPassDelays, nap::rtti::EPropertyMetaData::Default)
@@ -45,6 +47,12 @@ namespace nap
             }
 
 
+            ReverbNode::~ReverbNode()
+            {
+                NAP_AUDIO_NODE_RELEASE();
+            }
+
+
             void ReverbNode::setSize(ControllerValue value)
             {
                 mSize = math::fit(value, 0.f, 1.f, 0.01f, 1.6f);
@@ -162,13 +170,15 @@ namespace nap
                 if (inputBuffer == nullptr)
                     return;
 
+                auto diffusionInputBuffer1 = diffusionInput1.pull();
+                auto diffusionInputBuffer2 = diffusionInput2.pull();
+                auto diffusionInputBuffer3 = diffusionInput3.pull();
+                NAP_AUDIO_NODE_SCOPE();
+
                 auto& outputBuffer = getOutputBuffer(audioOutput);
                 auto& diffusionOutputBuffer1 = getOutputBuffer(diffusionOutput1);
                 auto& diffusionOutputBuffer2 = getOutputBuffer(diffusionOutput2);
                 auto& diffusionOutputBuffer3 = getOutputBuffer(diffusionOutput3);
-                auto diffusionInputBuffer1 = diffusionInput1.pull();
-                auto diffusionInputBuffer2 = diffusionInput2.pull();
-                auto diffusionInputBuffer3 = diffusionInput3.pull();
 
                 for (auto i = 0; i < outputBuffer.size(); ++i)
                 {
@@ -209,7 +219,7 @@ namespace nap
 
                     // Delay tuned to size
                     value = mDelays[1].process(value);
-                    mFeedbackInput = value;
+                    mFeedbackInput = flushDenormal(value);
                     auto diffusionInput4 = value;
                     diffusionOutputBuffer3[i] = value;
 
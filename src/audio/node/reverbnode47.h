@@ -71,6 +71,7 @@ namespace nap
             RTTI_ENABLE(Node)
             public:
                 ReverbNode(NodeManager& nodeManager);
+                ~ReverbNode() override;
 
                 InputPin audioInput = { this };      ///< Connect audio input signal
                 OutputPin audioOutput = { this };    ///< The reverberated output signal
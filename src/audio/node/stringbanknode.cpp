@@ -0,0 +1,155 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "stringbanknode.h"
+
+// Std includes
+#include <algorithm>
+
+// Audio includes
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/nodeprofiler.h>
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::StringBankNode)
+    RTTI_PROPERTY("audioInput", &nap::audio::StringBankNode::audioInput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_PROPERTY("audioOutput", &nap::audio::StringBankNode::audioOutput, nap::rtti::EPropertyMetaData::Embedded)
+    RTTI_FUNCTION("setStringCount", &nap::audio::StringBankNode::setStringCount)
+    RTTI_FUNCTION("getStringCount", &nap::audio::StringBankNode::getStringCount)
+    RTTI_FUNCTION("getMaxStringCount", &nap::audio::StringBankNode::getMaxStringCount)
+    RTTI_FUNCTION("setDelayTime", &nap::audio::StringBankNode::setDelayTime)
+    RTTI_FUNCTION("setFrequency", &nap::audio::StringBankNode::setFrequency)
+    RTTI_FUNCTION("setFeedback", &nap::audio::StringBankNode::setFeedback)
+    RTTI_FUNCTION("setDamping", &nap::audio::StringBankNode::setDamping)
+    RTTI_FUNCTION("setNegativePolarity", &nap::audio::StringBankNode::setNegativePolarity)
+    RTTI_FUNCTION("setInputGain", &nap::audio::StringBankNode::setInputGain)
+    RTTI_FUNCTION("pluck", &nap::audio::StringBankNode::pluck)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        StringBankNode::StringBankNode(NodeManager& nodeManager, int maxStringCount, TimeValue maxDelayTime) : Node(nodeManager)
+        {
+            allocate(maxStringCount, maxDelayTime);
+            mLowCut.setCutoffFrequency(20.f, nodeManager.getSampleRate());
+        }
+
+
+        StringBankNode::~StringBankNode()
+        {
+            NAP_AUDIO_NODE_RELEASE();
+        }
+
+
+        void StringBankNode::allocate(int maxStringCount, TimeValue maxDelayTime)
+        {
+            mStringCount = maxStringCount;
+            mMaxStringCount = maxStringCount;
+            mBank.resize(maxStringCount, maxDelayTime * getNodeManager().getSamplesPerMillisecond());
+            mDelayTimes.assign(maxStringCount, 100.f / getNodeManager().getSamplesPerMillisecond());
+            mDampings.assign(maxStringCount, 5000.f);
+            for (auto string = 0; string < maxStringCount; ++string)
+                mBank.setDamping(string, mDampings[string], getNodeManager().getSampleRate());
+        }
+
+
+        void StringBankNode::setStringCount(int stringCount)
+        {
+            stringCount = std::max(0, std::min(stringCount, mMaxStringCount));
+            auto previousCount = mStringCount;
+            mStringCount = stringCount;
+            getNodeManager().enqueueTask([&, stringCount, previousCount](){
+                mBank.setStringCount(stringCount);
+                for (auto string = previousCount; string < stringCount; ++string)
+                {
+                    mDelayTimes[string] = 100.f / getNodeManager().getSamplesPerMillisecond();
+                    mDampings[string] = 5000.f;
+                    mBank.setDamping(string, mDampings[string], getNodeManager().getSampleRate());
+                }
+            });
+        }
+
+
+        void StringBankNode::setDelayTime(int string, TimeValue time)
+        {
+            assert(string < mStringCount);
+            getNodeManager().enqueueTask([&, string, time](){
+                mDelayTimes[string] = time;
+                mBank.setDelayTime(string, time * getNodeManager().getSamplesPerMillisecond());
+            });
+        }
+
+
+        void StringBankNode::setFrequency(int string, ControllerValue frequency)
+        {
+            setDelayTime(string, 1000.f / std::max(frequency, 1.f));
+        }
+
+
+        void StringBankNode::setFeedback(int string, ControllerValue feedback)
+        {
+            assert(string < mStringCount);
+            getNodeManager().enqueueTask([&, string, feedback](){ mBank.setFeedback(string, feedback); });
+        }
+
+
+        void StringBankNode::setDamping(int string, ControllerValue frequency)
+        {
+            assert(string < mStringCount);
+            getNodeManager().enqueueTask([&, string, frequency](){
+                mDampings[string] = frequency;
+                mBank.setDamping(string, frequency, getNodeManager().getSampleRate());
+            });
+        }
+
+
+        void StringBankNode::setNegativePolarity(int string, bool value)
+        {
+            assert(string < mStringCount);
+            getNodeManager().enqueueTask([&, string, value](){ mBank.setNegativePolarity(string, value); });
+        }
+
+
+        void StringBankNode::setInputGain(int string, ControllerValue gain)
+        {
+            assert(string < mStringCount);
+            getNodeManager().enqueueTask([&, string, gain](){ mBank.setInputGain(string, gain); });
+        }
+
+
+        void StringBankNode::pluck(int string, ControllerValue amplitude)
+        {
+            assert(string < mStringCount);
+            getNodeManager().enqueueTask([&, string, amplitude](){ mBank.pluck(string, amplitude); });
+        }
+
+
+        void StringBankNode::process()
+        {
+            auto inputBuffer = audioInput.pull();
+            NAP_AUDIO_NODE_SCOPE();
+            auto& outputBuffer = getOutputBuffer(audioOutput);
+
+            mBank.process((inputBuffer != nullptr) ? inputBuffer->data() : nullptr, outputBuffer.data(), outputBuffer.size());
+            for (auto i = 0; i < outputBuffer.size(); ++i)
+                outputBuffer[i] = mLowCut.process(outputBuffer[i]);
+        }
+
+
+        void StringBankNode::sampleRateChanged(float sampleRate)
+        {
+            mLowCut.setCutoffFrequency(20.f, sampleRate);
+            for (auto string = 0; string < mMaxStringCount; ++string)
+            {
+                mBank.setDelayTime(string, mDelayTimes[string] * sampleRate / 1000.f);
+                mBank.setDamping(string, mDampings[string], sampleRate);
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,121 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/utility/karplusstrongbank.h>
+#include <audio/utility/onepole.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Node that runs a bank of Karplus strong strings, eight at a time in float8 lanes, see KarplusStrongBank.
+         * Replaces a KarplusStrongNode per string for installations with many strings.
+         * The strings are excited by the audio input and by pluck(), and their sum is sent to the output.
+         * Memory is allocated for a maximum number of strings on construction and by allocate(). All other methods can be called from the control thread, they are executed at the start of the next buffer.
+         */
+        class NAPAPI StringBankNode : public Node
+        {
+            RTTI_ENABLE(Node)
+
+        public:
+            /**
+             * Constructor
+             * @param nodeManager The node manager the node is processed on.
+             * @param maxStringCount Maximum number of strings, all of them are active initially.
+             * @param maxDelayTime Maximum delay time in ms, which determines the lowest frequency of the strings.
+             */
+            StringBankNode(NodeManager& nodeManager, int maxStringCount = 8, TimeValue maxDelayTime = 50.f);
+            ~StringBankNode() override;
+
+            InputPin audioInput = { this };       ///< Input signal fed into all strings, multiplied by their input gain.
+            OutputPin audioOutput = { this };     ///< Sum of all strings.
+
+            /**
+             * Changes the maximum number of strings and the maximum delay time, activates all strings and resets them.
+             * Allocates memory, so can only be called during initialization before the node is processed.
+             * @param maxStringCount Maximum number of strings.
+             * @param maxDelayTime Maximum delay time in ms.
+             */
+            void allocate(int maxStringCount, TimeValue maxDelayTime = 50.f);
+
+            /**
+             * Changes the number of strings that are processed, without allocating memory.
+             * Strings that become active are reset to their default settings.
+             * @param stringCount Number of strings, clamped to the maximum number of strings.
+             */
+            void setStringCount(int stringCount);
+
+            /**
+             * @return The number of strings.
+             */
+            int getStringCount() const { return mStringCount; }
+
+            /**
+             * @return The maximum number of strings.
+             */
+            int getMaxStringCount() const { return mMaxStringCount; }
+
+            /**
+             * Sets the delay time of a string in ms.
+             */
+            void setDelayTime(int string, TimeValue time);
+
+            /**
+             * Sets the delay time of a string to the period of a frequency in Hz.
+             */
+            void setFrequency(int string, ControllerValue frequency);
+
+            /**
+             * Sets the feedback multiplier of a string, lower than 1.
+             */
+            void setFeedback(int string, ControllerValue feedback);
+
+            /**
+             * Sets the damping of a string, which equals the cutoff frequency in Hz of the lowpass filter in its feedback loop.
+             */
+            void setDamping(int string, ControllerValue frequency);
+
+            /**
+             * Sets the polarity of the feedback loop of a string. A negative polarity means that the feedback signal will be subtracted from the input instead of added.
+             */
+            void setNegativePolarity(int string, bool value);
+
+            /**
+             * Sets the gain of the audio input for a string.
+             */
+            void setInputGain(int string, ControllerValue gain);
+
+            /**
+             * Excites a string with a short burst of noise.
+             * @param string Index of the string.
+             * @param amplitude Amplitude of the burst.
+             */
+            void pluck(int string, ControllerValue amplitude);
+
+        private:
+            // Inherited from Node
+            void process() override;
+            void sampleRateChanged(float sampleRate) override;
+
+            int mStringCount = 0;
+            int mMaxStringCount = 0;
+            KarplusStrongBank mBank;
+            OnePoleHighPass<SampleValue> mLowCut;
+            std::vector<TimeValue> mDelayTimes;         // In ms per string up to the maximum, to update the strings when the sample rate changes
+            std::vector<ControllerValue> mDampings;     // In Hz per string up to the maximum, to update the strings when the sample rate changes
+        };
+
+    }
+
+}
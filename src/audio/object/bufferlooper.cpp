@@ -4,6 +4,9 @@
 
 #include "bufferlooper.h"
 
+// Audio includes
+#include <audio/utility/audiofunctions.h>
+
 RTTI_BEGIN_STRUCT(nap::audio::BufferLooper::Settings)
     RTTI_PROPERTY("Buffer", &nap::audio::BufferLooper::Settings::mBufferResource, nap::rtti::EPropertyMetaData::Required)
     RTTI_PROPERTY("Loop", &nap::audio::BufferLooper::Settings::mLoop, nap::rtti::EPropertyMetaData::Default)
@@ -95,88 +98,14 @@ namespace nap
             if (!mSettings.init(errorState))
                 return false;
             
-            mBufferPlayer = std::make_unique<BufferPlayer>();
-            mBufferPlayer->mID = "BufferPlayer";
-            mBufferPlayer->mAutoPlay = false;
-            mBufferPlayer->mBufferResource = mSettings.mBufferResource;
-            mBufferPlayer->mChannelCount = channelCount;
-            if (!mBufferPlayer->init(errorState))
+            if (equalPowerTable == nullptr)
             {
-                errorState.fail("Failed to initialize BufferLooper " + getName());
+                errorState.fail("Failed to initialize BufferLooper %s: no EqualPowerTable", getName().c_str());
                 return false;
             }
             
-            EnvelopeNode::Segment attack;
-            attack.mDestination = 1.f;
-            attack.mDuration = 0.f;
-            attack.mDurationRelative = false;
-            attack.mTranslate = true;
-            attack.mMode = RampMode::Linear;
-            
-            EnvelopeNode::Segment sustain;
-            sustain.mDestination = 1.f;
-            sustain.mDuration = mSettings.getFirstSustainDuration();
-            sustain.mDurationRelative = false;
-            sustain.mTranslate = false;
-            sustain.mMode = RampMode::Linear;
-            
-            EnvelopeNode::Segment decay;
-            decay.mDestination = 0.f;
-            decay.mDuration = mSettings.mCrossFadeTime;
-            decay.mDurationRelative = false;
-            decay.mTranslate = true;
-            decay.mMode = RampMode::Linear;
-            
-            mEnvelope = std::make_unique<Envelope>();
-            mEnvelope->mID = "Envelope";
-            mEnvelope->mSegments.emplace_back(attack);
-            mEnvelope->mSegments.emplace_back(sustain);
-            mEnvelope->mSegments.emplace_back(decay);
-            mEnvelope->mAutoTrigger = false;
-            mEnvelope->mEqualPowerTable = equalPowerTable;
-            if (!mEnvelope->init(errorState))
-            {
-                errorState.fail("Failed to initialize BufferLooper " + getName());
-                return false;
-            }
-            
-            mGain = std::make_unique<Multiply>();
-            mGain->mID = "Gain";
-            mGain->mChannelCount = channelCount;
-            mGain->mInputs.emplace_back(mBufferPlayer.get());
-            mGain->mInputs.emplace_back(mEnvelope.get());
-            if (!mGain->init(errorState))
-            {
-                errorState.fail("Failed to initialize BufferLooper " + getName());
-                return false;
-            }
-            
-            mVoice = std::make_unique<Voice>();
-            mVoice->mID = "Voice";
-            mVoice->mObjects.emplace_back(mBufferPlayer.get());
-            mVoice->mObjects.emplace_back(mGain.get());
-            mVoice->mObjects.emplace_back(mEnvelope.get());
-            mVoice->mEnvelope = mEnvelope.get();
-            mVoice->mOutput = mGain.get();
-            if (!mVoice->init(errorState))
-            {
-                errorState.fail("Failed to initialize BufferLooper " + getName());
-                return false;
-            }
-            
-            mPolyphonic = std::make_unique<Polyphonic>();
-            mPolyphonic->mID = "Polyphonic";
-            mPolyphonic->mVoice = mVoice.get();
-            mPolyphonic->mChannelCount = channelCount;
-            mPolyphonic->mVoiceCount = 2;
-            mPolyphonic->mVoiceStealing = true;
-            if (!mPolyphonic->init(errorState))
-            {
-                errorState.fail("Failed to initialize BufferLooper " + getName());
-                return false;
-            }
-
-            mPolyphonicInstance = mPolyphonic->instantiate<PolyphonicInstance>(nodeManager, errorState);
+            for (auto channel = 0; channel < channelCount; ++channel)
+                mNodes.emplace_back(nodeManager.makeSafe<LoopingPlayerNode>(nodeManager, equalPowerTable->getTable()));
             
             if (autoPlay)
                 start();
@@ -187,81 +116,39 @@ namespace nap
         
         void BufferLooperInstance::start()
         {
-            startVoice(true);
+            start(mSettings);
         }
         
         
-        void BufferLooperInstance::start(BufferLooper::Settings& settings)
+        void BufferLooperInstance::start(const BufferLooper::Settings& settings, ControllerValue transpose)
         {
             mSettings = settings;
-            startVoice(true);
+            auto& buffer = *mSettings.mBufferResource;
+
+            LoopingPlayerNode::Loop loop;
+            loop.mStart = buffer.toSamples(mSettings.mStart);
+            loop.mLoopStart = buffer.toSamples(mSettings.mLoopStart);
+            loop.mLoopEnd = buffer.toSamples(mSettings.mLoopEnd);
+            loop.mCrossFade = buffer.toSamples(mSettings.mCrossFadeTime);
+            loop.mLoop = mSettings.mLoop;
+
+            auto speed = mtof(64.f + mSettings.mTranspose + transpose) / mtof(64.f);
+            for (auto channel = 0; channel < mNodes.size(); ++channel)
+                mNodes[channel]->play(buffer.getBuffer(), channel, loop, speed);
         }
 
         
         void BufferLooperInstance::stop(TimeValue fadeOutTime)
         {
-            for (auto voice : mVoices)
-                voice->stop(fadeOutTime);
+            for (auto& node : mNodes)
+                node->stop(fadeOutTime);
         }
 
 
         void BufferLooperInstance::reset()
         {
-            mPolyphonicInstance->reset();
-            mVoices.clear();
-        }
-        
-        
-        void BufferLooperInstance::segmentFinished(EnvelopeNode& envelope)
-        {
-            if (envelope.getCurrentSegment() == 1)
-            {
-                startVoice(false);
-            }
-        }
-        
-        
-        void BufferLooperInstance::startVoice(bool fromStart)
-        {
-            auto voice = mPolyphonicInstance->findFreeVoice();
-            assert(voice != nullptr);
-            mVoices.emplace(voice);
-            auto bufferPlayer = voice->getObject<ParallelNodeObjectInstance<BufferPlayerNode>>("BufferPlayer");
-            auto& envelope = voice->getEnvelope();
-            
-            for (auto channel = 0; channel < bufferPlayer->getChannelCount(); ++channel)
-            {
-                auto bufferPlayerChannel = bufferPlayer->getChannel(channel);
-                bufferPlayerChannel->stop();
-                bufferPlayerChannel->setBuffer(mSettings.mBufferResource->getBuffer());
-            }
-            
-            envelope.getSegmentFinishedSignal().disconnect(segmentFinishedSlot); // We need to disconnect first to avoid connecting to the same signal twice.
-            envelope.getSegmentFinishedSignal().connect(segmentFinishedSlot);
-            
-            auto speed = mtof(64.f + mSettings.mTranspose) / mtof(64.f);
-            
-            if (fromStart)
-            {
-                envelope.setSegmentData(0, 0, 1.f, false, false, false);
-                envelope.setSegmentData(1, mSettings.getFirstSustainDuration() * speed, 1.f, false, false, true);
-                envelope.setSegmentData(2, mSettings.mCrossFadeTime * speed, 0.f, false, false, true);
-                for (auto channel = 0; channel < getChannelCount(); ++channel)
-                {
-                    bufferPlayer->getChannel(channel)->play(channel, mSettings.mBufferResource->toSamples(mSettings.mStart), speed);
-                }
-            }
-            else {
-                envelope.setSegmentData(0, mSettings.mCrossFadeTime * speed, 1.f, false, false, true);
-                envelope.setSegmentData(1, mSettings.getLoopSustainDuration() * speed, 1.f, false, false, true);
-                envelope.setSegmentData(2, mSettings.mCrossFadeTime * speed, 0.f, false, false, true);
-                for (auto channel = 0; channel < getChannelCount(); ++channel)
-                {
-                    bufferPlayer->getChannel(channel)->play(channel, mSettings.mBufferResource->toSamples(mSettings.mStart), speed);
-                }
-            }
-            
-            mPolyphonicInstance->play(voice);
+            for (auto& node : mNodes)
+                node->stop(0.f);
         }
         
         
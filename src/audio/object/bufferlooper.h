@@ -4,9 +4,14 @@
 
 #pragma once
 
-#include <audio/object/bufferplayer.h>
-#include <audio/object/multiply.h>
-#include <audio/core/polyphonic.h>
+// Nap includes
+#include <nap/resourceptr.h>
+
+// Audio includes
+#include <audio/core/audioobject.h>
+#include <audio/node/loopingplayernode.h>
+#include <audio/resource/audiobufferresource.h>
+#include <audio/resource/equalpowertable.h>
 
 namespace nap
 {
@@ -78,7 +83,7 @@ namespace nap
 
         /**
          * Instance of BufferLooper.
-         * Works internally using a Polyphonic containing just two voices that are being crossfaded.
+         * Works internally using a LoopingPlayerNode per channel that performs the crossfade.
          */
         class NAPAPI BufferLooperInstance : public AudioObjectInstance
         {
@@ -101,8 +106,8 @@ namespace nap
             bool init(BufferLooper::Settings& settings, ResourcePtr<EqualPowerTable> equalPowerTable, int channelCount, bool autoPlay, NodeManager& nodeManager, utility::ErrorState& errorState);
 
             // Inherited from AudioObjectInstance
-            OutputPin* getOutputForChannel(int channel) override { return mPolyphonicInstance->getOutputForChannel(channel); }
-            int getChannelCount() const override { return mPolyphonicInstance->getChannelCount(); }
+            OutputPin* getOutputForChannel(int channel) override { return &mNodes[channel]->audioOutput; }
+            int getChannelCount() const override { return mNodes.size(); }
 
             /**
              * Starts playback with the default settings that were passed on initialization.
@@ -112,8 +117,9 @@ namespace nap
             /**
              * Starts playback
              * @param settings Settings to be used for playback
+             * @param transpose Transposition in semitones on top of the transposition of the settings
              */
-            void start(BufferLooper::Settings& settings);
+            void start(const BufferLooper::Settings& settings, ControllerValue transpose = 0.f);
 
             /**
              * Stops playback
@@ -122,27 +128,13 @@ namespace nap
             void stop(TimeValue fadeOutTime);
 
             /**
-             * Performs a hard reset on current playback. All voices will be stopped.
+             * Performs a hard reset on current playback. Playback is stopped without fading out.
              */
             void reset();
             
         private:
             BufferLooper::Settings mSettings;
-            
-            Slot<EnvelopeNode&> segmentFinishedSlot = {this, &BufferLooperInstance::segmentFinished };
-            void segmentFinished(EnvelopeNode& envelope);
-            
-            void startVoice(bool fromStart);
-
-            std::unique_ptr<PolyphonicInstance> mPolyphonicInstance = nullptr;
-            std::set<VoiceInstance*> mVoices;
-            
-            // private resources
-            std::unique_ptr<Envelope> mEnvelope = nullptr;
-            std::unique_ptr<BufferPlayer> mBufferPlayer = nullptr;
-            std::unique_ptr<Multiply> mGain = nullptr;
-            std::unique_ptr<Voice> mVoice = nullptr;
-            std::unique_ptr<Polyphonic> mPolyphonic = nullptr;
+            std::vector<SafeOwner<LoopingPlayerNode>> mNodes; // Player for each channel
         };
         
         
@@ -47,6 +47,12 @@ namespace nap
     
         bool CircularBufferInstance::init(AudioObjectInstance& input, const std::vector<int>& channelRouting, bool rootProcess, int bufferSize, NodeManager& nodeManager, utility::ErrorState& errorState)
         {
+            if (bufferSize <= 0 || (bufferSize & (bufferSize - 1)) != 0)
+            {
+                errorState.fail("%s: BufferSize has to be a power of two.", getName().c_str());
+                return false;
+            }
+
             auto channelCount = channelRouting.size();
             
             for (auto channel = 0; channel < channelCount; ++channel)
@@ -74,6 +80,12 @@ namespace nap
 
         bool CircularBufferInstance::init(int channelCount, bool rootProcess, int bufferSize, NodeManager &nodeManager,
                                           utility::ErrorState &errorState) {
+            if (bufferSize <= 0 || (bufferSize & (bufferSize - 1)) != 0)
+            {
+                errorState.fail("%s: BufferSize has to be a power of two.", getName().c_str());
+                return false;
+            }
+
             for (auto channel = 0; channel < channelCount; ++channel)
             {
                 auto node = nodeManager.makeSafe<CircularBufferNode>(nodeManager, bufferSize, rootProcess);
@@ -14,6 +14,9 @@ RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::EnvelopeInstance)
     RTTI_FUNCTION("trigger", &nap::audio::EnvelopeInstance::trigger)
     RTTI_FUNCTION("triggerSection", &nap::audio::EnvelopeInstance::triggerSection)
     RTTI_FUNCTION("stop", &nap::audio::EnvelopeInstance::stop)
+    RTTI_FUNCTION("scheduleTrigger", &nap::audio::EnvelopeInstance::scheduleTrigger)
+    RTTI_FUNCTION("scheduleTriggerSection", &nap::audio::EnvelopeInstance::scheduleTriggerSection)
+    RTTI_FUNCTION("scheduleStop", &nap::audio::EnvelopeInstance::scheduleStop)
     RTTI_FUNCTION("setSegmentData", &nap::audio::EnvelopeInstance::setSegmentData)
 	RTTI_FUNCTION("getValue", &nap::audio::EnvelopeInstance::getValue)
 RTTI_END_CLASS
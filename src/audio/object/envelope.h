@@ -54,8 +54,14 @@ namespace nap
             bool init(EnvelopeNode::Envelope segments, bool autoTrigger, NodeManager& nodeManager, audio::SafePtr<Translator<float>> translator, utility::ErrorState& errorState);
             
             OutputPin* getOutputForChannel(int channel) override { return &mEnvelopeGenerator->output; }
+            ControlRateOutputPin* getControlOutputForChannel(int channel) override { return &mEnvelopeGenerator->controlOutput; }
             int getChannelCount() const override { return 1; }
 
+            /**
+             * @return The output of the envelope generator at control rate, see @ControlRateOutputPin.
+             */
+            ControlRateOutputPin& getControlOutput() { return mEnvelopeGenerator->controlOutput; }
+
             /**
              * Triggers the envelope to start playing from the start segment.
              * If @totalDuration does not equal zero the relative durations in the segments will be scaled in order to get the total duration of the envelope to match this parameter.
@@ -85,6 +91,40 @@ namespace nap
              */
             void stop(TimeValue rampTime) { mEnvelopeGenerator->stop(rampTime); }
 
+            /**
+             * Schedules the envelope to start playing from the start segment at an exact sample time.
+             * @param time Absolute sample time of the node manager at which the envelope will be triggered.
+             * @param totalDuration If not zero the relative durations in the segments will be scaled in order to get the total duration of the envelope to match this parameter.
+             * @return False if the event could not be scheduled because the event queue was full.
+             */
+            bool scheduleTrigger(DiscreteTimeValue time, TimeValue totalDuration = 0)
+            {
+                return mEnvelopeGenerator->scheduleTrigger(time, 0, mEnvelopeGenerator->getEnvelope().size() - 1, 0, totalDuration);
+            }
+
+            /**
+             * Schedules a section of the envelope to be triggered at an exact sample time.
+             * @param time Absolute sample time of the node manager at which the section will be triggered.
+             * @param startSegment: the start segment of the envelope section to be played
+             * @param endSegment: the end segment of the envelope section to be played
+             * @param startValue: the startValue of the line when the section is triggered.
+             * @param totalDuration: if this value is greater than the total of all durations of segments that have durationRelative = false
+             the resting time wille be divided over the segments with durationRelative = true, using their duration values as denominator.
+             * @return False if the event could not be scheduled because the event queue was full.
+             */
+            bool scheduleTriggerSection(DiscreteTimeValue time, int startSegment, int endSegment, ControllerValue startValue = 0, TimeValue totalDuration = 0)
+            {
+                return mEnvelopeGenerator->scheduleTrigger(time, startSegment, endSegment, startValue, totalDuration);
+            }
+
+            /**
+             * Schedules the envelope to fade out at an exact sample time.
+             * @param time Absolute sample time of the node manager at which the fade out starts.
+             * @param rampTime fade out time in ms
+             * @return False if the event could not be scheduled because the event queue was full.
+             */
+            bool scheduleStop(DiscreteTimeValue time, TimeValue rampTime) { return mEnvelopeGenerator->scheduleStop(time, rampTime); }
+
              /**
               * Sets the envelope data for one segment of the envelope.
               * @param segmentIndex Specifies which segment will be edited.
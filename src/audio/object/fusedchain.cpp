@@ -0,0 +1,106 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "fusedchain.h"
+
+RTTI_BEGIN_CLASS(nap::audio::LowPassGainChain)
+    RTTI_PROPERTY("GainInput", &nap::audio::LowPassGainChain::mGainInput, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("CutoffFrequency", &nap::audio::LowPassGainChain::mCutoffFrequency, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Gain", &nap::audio::LowPassGainChain::mGain, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS(nap::audio::BiquadGainChain)
+    RTTI_PROPERTY("GainInput", &nap::audio::BiquadGainChain::mGainInput, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Mode", &nap::audio::BiquadGainChain::mMode, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Frequency", &nap::audio::BiquadGainChain::mFrequency, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Q", &nap::audio::BiquadGainChain::mQ, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Gain", &nap::audio::BiquadGainChain::mGain, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS(nap::audio::KarplusStrongGainChain)
+    RTTI_PROPERTY("GainInput", &nap::audio::KarplusStrongGainChain::mGainInput, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Frequency", &nap::audio::KarplusStrongGainChain::mFrequency, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Feedback", &nap::audio::KarplusStrongGainChain::mFeedback, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Damping", &nap::audio::KarplusStrongGainChain::mDamping, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("HighPass", &nap::audio::KarplusStrongGainChain::mHighPass, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Gain", &nap::audio::KarplusStrongGainChain::mGain, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::ParallelNodeObjectInstance<nap::audio::LowPassGainNode>)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::ParallelNodeObjectInstance<nap::audio::BiquadGainNode>)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::ParallelNodeObjectInstance<nap::audio::KarplusStrongGainNode>)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+            // Connects a channel of the gain input object to the gain input of a chain node.
+            bool connectGainInput(AudioObject* gainInput, int channel, InputPin& pin, utility::ErrorState& errorState)
+            {
+                if (gainInput == nullptr)
+                    return true;
+
+                auto instance = gainInput->getInstance();
+                if (instance == nullptr || instance->getChannelCount() == 0)
+                {
+                    errorState.fail("GainInput has no output channels: %s", gainInput->mID.c_str());
+                    return false;
+                }
+                pin.connect(*instance->getOutputForChannel(channel % instance->getChannelCount()));
+                return true;
+            }
+        }
+
+
+        bool LowPassGainChain::initNode(int channel, LowPassGainNode& node, utility::ErrorState& errorState)
+        {
+            auto cutoffFrequency = mCutoffFrequency;
+            auto gain = mGain;
+            node.update<0>([cutoffFrequency](OnePoleLowPassKernel& kernel){ kernel.setCutoffFrequency(cutoffFrequency); });
+            node.update<1>([gain](GainKernel& kernel){ kernel.setGain(gain); });
+            return connectGainInput(mGainInput.get(), channel, node.gainInput, errorState);
+        }
+
+
+        bool BiquadGainChain::initNode(int channel, BiquadGainNode& node, utility::ErrorState& errorState)
+        {
+            auto mode = mMode;
+            auto frequency = mFrequency;
+            auto q = mQ;
+            auto gain = mGain;
+            node.update<0>([mode, frequency, q](BiquadKernel& kernel){ kernel.setParameters(mode, frequency, q); });
+            node.update<1>([gain](GainKernel& kernel){ kernel.setGain(gain); });
+            return connectGainInput(mGainInput.get(), channel, node.gainInput, errorState);
+        }
+
+
+        bool KarplusStrongGainChain::initNode(int channel, KarplusStrongGainNode& node, utility::ErrorState& errorState)
+        {
+            auto frequency = mFrequency;
+            auto feedback = mFeedback;
+            auto damping = mDamping;
+            auto highPass = mHighPass;
+            auto gain = mGain;
+            node.update<0>([frequency, feedback, damping](KarplusStrongKernel& kernel){
+                kernel.setFrequency(frequency);
+                kernel.setFeedback(feedback);
+                kernel.setDamping(damping);
+            });
+            node.update<1>([highPass](OnePoleHighPassKernel& kernel){ kernel.setCutoffFrequency(highPass); });
+            node.update<2>([gain](GainKernel& kernel){ kernel.setGain(gain); });
+            return connectGainInput(mGainInput.get(), channel, node.gainInput, errorState);
+        }
+
+    }
+
+}
@@ -0,0 +1,89 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <nap/resourceptr.h>
+
+// Audio includes
+#include <audio/core/nodeobject.h>
+#include <audio/node/fusedchainnode.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Multichannel object running a LowPassGainNode per channel.
+         * Replaces a Chain of a lowpass filter, a gain and a Multiply with an envelope.
+         */
+        class NAPAPI LowPassGainChain : public ParallelNodeObject<LowPassGainNode>
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            LowPassGainChain() = default;
+
+            ResourcePtr<AudioObject> mGainInput = nullptr;  ///< Property: 'GainInput' Optional object whose output is multiplied with the output of the chain, for example an envelope.
+            ControllerValue mCutoffFrequency = 20000.f;     ///< Property: 'CutoffFrequency' Cutoff frequency of the lowpass filter in Hz.
+            ControllerValue mGain = 1.f;                    ///< Property: 'Gain' Gain multiplier.
+
+        private:
+            bool initNode(int channel, LowPassGainNode& node, utility::ErrorState& errorState) override;
+        };
+
+
+        /**
+         * Multichannel object running a BiquadGainNode per channel.
+         */
+        class NAPAPI BiquadGainChain : public ParallelNodeObject<BiquadGainNode>
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            BiquadGainChain() = default;
+
+            ResourcePtr<AudioObject> mGainInput = nullptr;          ///< Property: 'GainInput' Optional object whose output is multiplied with the output of the chain, for example an envelope.
+            BiquadKernel::Mode mMode = BiquadKernel::Mode::LowPass; ///< Property: 'Mode' LowPass, HighPass or BandPass.
+            ControllerValue mFrequency = 20000.f;                   ///< Property: 'Frequency' Cutoff or center frequency in Hz.
+            ControllerValue mQ = 0.707f;                            ///< Property: 'Q' Resonance, or center frequency divided by bandwidth for the bandpass.
+            ControllerValue mGain = 1.f;                            ///< Property: 'Gain' Gain multiplier.
+
+        private:
+            bool initNode(int channel, BiquadGainNode& node, utility::ErrorState& errorState) override;
+        };
+
+
+        /**
+         * Multichannel object running a KarplusStrongGainNode per channel.
+         */
+        class NAPAPI KarplusStrongGainChain : public ParallelNodeObject<KarplusStrongGainNode>
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            KarplusStrongGainChain() = default;
+
+            ResourcePtr<AudioObject> mGainInput = nullptr;  ///< Property: 'GainInput' Optional object whose output is multiplied with the output of the chain, for example an envelope.
+            ControllerValue mFrequency = 440.f;             ///< Property: 'Frequency' Pitch of the string in Hz.
+            ControllerValue mFeedback = 0.99f;              ///< Property: 'Feedback' Feedback of the string, lower than 1.
+            ControllerValue mDamping = 5000.f;              ///< Property: 'Damping' Cutoff frequency of the damping filter in the feedback loop in Hz.
+            ControllerValue mHighPass = 20.f;               ///< Property: 'HighPass' Cutoff frequency of the highpass filter after the string in Hz.
+            ControllerValue mGain = 1.f;                    ///< Property: 'Gain' Gain multiplier.
+
+        private:
+            bool initNode(int channel, KarplusStrongGainNode& node, utility::ErrorState& errorState) override;
+        };
+
+
+        using LowPassGainChainInstance = ParallelNodeObjectInstance<LowPassGainNode>;
+        using BiquadGainChainInstance = ParallelNodeObjectInstance<BiquadGainNode>;
+        using KarplusStrongGainChainInstance = ParallelNodeObjectInstance<KarplusStrongGainNode>;
+
+    }
+
+}
@@ -0,0 +1,67 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "graincloud.h"
+
+RTTI_BEGIN_CLASS(nap::audio::GrainCloud)
+    RTTI_PROPERTY("CircularBuffer", &nap::audio::GrainCloud::mCircularBuffer, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Buffer", &nap::audio::GrainCloud::mBuffer, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Density", &nap::audio::GrainCloud::mDensity, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Duration", &nap::audio::GrainCloud::mDuration, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Position", &nap::audio::GrainCloud::mPosition, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("PositionJitter", &nap::audio::GrainCloud::mPositionJitter, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Speed", &nap::audio::GrainCloud::mSpeed, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("SpeedJitter", &nap::audio::GrainCloud::mSpeedJitter, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Gain", &nap::audio::GrainCloud::mGain, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("GainJitter", &nap::audio::GrainCloud::mGainJitter, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Window", &nap::audio::GrainCloud::mWindow, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::ParallelNodeObjectInstance<nap::audio::GrainCloudNode>)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        bool GrainCloud::initNode(int channel, GrainCloudNode& node, utility::ErrorState& errorState)
+        {
+            if (mCircularBuffer != nullptr)
+            {
+                auto circularBuffer = rtti_cast<CircularBufferInstance>(mCircularBuffer->getInstance());
+                if (circularBuffer == nullptr || circularBuffer->getBufferChannelCount() == 0)
+                {
+                    errorState.fail("GrainCloud: CircularBuffer has no channels: %s", mID.c_str());
+                    return false;
+                }
+                node.setBuffer(circularBuffer->getChannel(channel % circularBuffer->getBufferChannelCount()).get());
+            }
+            else if (mBuffer != nullptr)
+            {
+                auto channelCount = mBuffer->getBuffer()->getChannelCount();
+                if (channelCount == 0)
+                {
+                    errorState.fail("GrainCloud: Buffer has no channels: %s", mID.c_str());
+                    return false;
+                }
+                node.setBuffer(mBuffer->getBuffer(), channel % channelCount, mBuffer->getSampleRate());
+            }
+
+            node.setDensity(mDensity);
+            node.setDuration(mDuration);
+            node.setPosition(mPosition);
+            node.setPositionJitter(mPositionJitter);
+            node.setSpeed(mSpeed);
+            node.setSpeedJitter(mSpeedJitter);
+            node.setGain(mGain);
+            node.setGainJitter(mGainJitter);
+            node.setWindow(mWindow);
+            return true;
+        }
+
+    }
+
+}
@@ -0,0 +1,57 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <nap/resourceptr.h>
+
+// Audio includes
+#include <audio/core/nodeobject.h>
+#include <audio/node/graincloudnode.h>
+#include <audio/object/circularbuffer.h>
+#include <audio/resource/audiobufferresource.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Object that plays a cloud of grains per channel, see GrainCloudNode.
+         * The grains read from either a CircularBuffer or an AudioBufferResource. Channels are mapped to the channels of the source modulo its channel count.
+         */
+        class NAPAPI GrainCloud : public ParallelNodeObject<GrainCloudNode>
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            GrainCloud() = default;
+
+            ResourcePtr<CircularBuffer> mCircularBuffer = nullptr;  ///< Property: 'CircularBuffer' Circular buffer the grains read from. Takes precedence over 'Buffer'.
+            ResourcePtr<AudioBufferResource> mBuffer = nullptr;     ///< Property: 'Buffer' Buffer resource the grains read from.
+            float mDensity = 0.f;                                   ///< Property: 'Density' Number of grains started per second.
+            float mDuration = 50.f;                                 ///< Property: 'Duration' Duration of the grains in milliseconds.
+            float mPosition = 100.f;                                ///< Property: 'Position' Read position in milliseconds. Behind the write position for a circular buffer, from the start for a buffer resource.
+            float mPositionJitter = 0.f;                            ///< Property: 'PositionJitter' Maximum random deviation of the read position in milliseconds.
+            float mSpeed = 1.f;                                     ///< Property: 'Speed' Playback speed of the grains.
+            float mSpeedJitter = 0.f;                               ///< Property: 'SpeedJitter' Maximum random deviation of the speed as a fraction of the speed.
+            float mGain = 1.f;                                      ///< Property: 'Gain' Peak gain of the grains.
+            float mGainJitter = 0.f;                                ///< Property: 'GainJitter' Maximum random reduction of the gain as a fraction of the gain.
+            GrainWindow mWindow = GrainWindow::Hann;                ///< Property: 'Window' Window shape of the grains: Hann, Triangle, Tukey or Gaussian.
+
+        private:
+            bool initNode(int channel, GrainCloudNode& node, utility::ErrorState& errorState) override;
+        };
+
+
+        /**
+         * Instance of GrainCloud
+         */
+        using GrainCloudInstance = ParallelNodeObjectInstance<GrainCloudNode>;
+
+    }
+
+}
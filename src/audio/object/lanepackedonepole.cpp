@@ -0,0 +1,46 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "lanepackedonepole.h"
+
+RTTI_BEGIN_CLASS(nap::audio::LanePackedLowPass)
+    RTTI_PROPERTY("CutoffFrequency", &nap::audio::LanePackedLowPass::mCutoffFrequency, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS(nap::audio::LanePackedHighPass)
+    RTTI_PROPERTY("CutoffFrequency", &nap::audio::LanePackedHighPass::mCutoffFrequency, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::LanePackedObjectInstance<nap::audio::LanePackedLowPassNode>)
+    RTTI_FUNCTION("getGroupCount", &nap::audio::LanePackedObjectInstance<nap::audio::LanePackedLowPassNode>::getGroupCount)
+    RTTI_FUNCTION("getGroup", &nap::audio::LanePackedObjectInstance<nap::audio::LanePackedLowPassNode>::getGroup)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::LanePackedObjectInstance<nap::audio::LanePackedHighPassNode>)
+    RTTI_FUNCTION("getGroupCount", &nap::audio::LanePackedObjectInstance<nap::audio::LanePackedHighPassNode>::getGroupCount)
+    RTTI_FUNCTION("getGroup", &nap::audio::LanePackedObjectInstance<nap::audio::LanePackedHighPassNode>::getGroup)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        bool LanePackedLowPass::initNode(int group, LanePackedLowPassNode& node, utility::ErrorState& errorState)
+        {
+            node.setCutoffFrequency(mCutoffFrequency);
+            return true;
+        }
+
+
+        bool LanePackedHighPass::initNode(int group, LanePackedHighPassNode& node, utility::ErrorState& errorState)
+        {
+            node.setCutoffFrequency(mCutoffFrequency);
+            return true;
+        }
+
+    }
+
+}
@@ -0,0 +1,56 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Audio includes
+#include <audio/core/lanepackedobject.h>
+#include <audio/node/lanepackedonepolenode.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Multichannel one pole lowpass filter that processes eight channels per node, see LanePackedObject.
+         */
+        class NAPAPI LanePackedLowPass : public LanePackedObject<LanePackedLowPassNode>
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            LanePackedLowPass() = default;
+
+            ControllerValue mCutoffFrequency = 20000.f; ///< Property: 'CutoffFrequency' Cutoff frequency of the filters in Hz.
+
+        private:
+            bool initNode(int group, LanePackedLowPassNode& node, utility::ErrorState& errorState) override;
+        };
+
+
+        /**
+         * Multichannel one pole highpass filter that processes eight channels per node, see LanePackedObject.
+         */
+        class NAPAPI LanePackedHighPass : public LanePackedObject<LanePackedHighPassNode>
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            LanePackedHighPass() = default;
+
+            ControllerValue mCutoffFrequency = 20.f; ///< Property: 'CutoffFrequency' Cutoff frequency of the filters in Hz.
+
+        private:
+            bool initNode(int group, LanePackedHighPassNode& node, utility::ErrorState& errorState) override;
+        };
+
+
+        using LanePackedLowPassInstance = LanePackedObjectInstance<LanePackedLowPassNode>;
+        using LanePackedHighPassInstance = LanePackedObjectInstance<LanePackedHighPassNode>;
+
+    }
+
+}
@@ -0,0 +1,41 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "multitapplayer.h"
+
+
+RTTI_BEGIN_CLASS(nap::audio::MultiTapPlayer)
+    RTTI_PROPERTY("CircularBuffer", &nap::audio::MultiTapPlayer::mCircularBuffer, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Interpolation", &nap::audio::MultiTapPlayer::mInterpolation, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::ParallelNodeObjectInstance<nap::audio::MultiTapPlayerNode>)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        bool MultiTapPlayer::initNode(int channel, MultiTapPlayerNode& node, utility::ErrorState& errorState)
+        {
+            if (mCircularBuffer != nullptr)
+            {
+                auto circularBuffer = rtti_cast<CircularBufferInstance>(mCircularBuffer->getInstance());
+                if (circularBuffer == nullptr || circularBuffer->getBufferChannelCount() == 0)
+                {
+                    errorState.fail("MultiTapPlayer: CircularBuffer has no channels: %s", mID.c_str());
+                    return false;
+                }
+                node.setBuffer(circularBuffer->getChannel(channel % circularBuffer->getBufferChannelCount()).get());
+            }
+
+            node.setInterpolation(mInterpolation);
+            return true;
+        }
+
+    }
+
+}
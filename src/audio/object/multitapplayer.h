@@ -0,0 +1,47 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <nap/resourceptr.h>
+
+// Audio includes
+#include <audio/core/nodeobject.h>
+#include <audio/node/multitapplayernode.h>
+#include <audio/object/circularbuffer.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Object to play back a number of taps from a circular buffer per channel, see MultiTapPlayerNode.
+         * Channels are mapped to the channels of the circular buffer modulo its channel count.
+         */
+        class NAPAPI MultiTapPlayer : public ParallelNodeObject<MultiTapPlayerNode>
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            MultiTapPlayer() = default;
+
+            ResourcePtr<CircularBuffer> mCircularBuffer = nullptr;      ///< Property: 'CircularBuffer' Circular buffer the taps read from.
+            TapInterpolation mInterpolation = TapInterpolation::Linear; ///< Property: 'Interpolation' Interpolation used to read between samples: Linear, Hermite or Sinc.
+
+        private:
+            bool initNode(int channel, MultiTapPlayerNode& node, utility::ErrorState& errorState) override;
+        };
+
+
+        /**
+         * Instance of MultiTapPlayer
+         */
+        using MultiTapPlayerInstance = ParallelNodeObjectInstance<MultiTapPlayerNode>;
+
+    }
+
+}
@@ -22,6 +22,7 @@ RTTI_BEGIN_CLASS(nap::audio::Oscillator)
     RTTI_PROPERTY("Frequency", &nap::audio::Oscillator::mFrequency, nap::rtti::EPropertyMetaData::Default)
     RTTI_PROPERTY("Amplitude", &nap::audio::Oscillator::mAmplitude, nap::rtti::EPropertyMetaData::Default)
     RTTI_PROPERTY("FmInput", &nap::audio::Oscillator::mFmInput, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("FmControlInput", &nap::audio::Oscillator::mFmControlInput, nap::rtti::EPropertyMetaData::Default)
     RTTI_PROPERTY("WaveTables", &nap::audio::Oscillator::mWaveTables, nap::rtti::EPropertyMetaData::Required)
 	RTTI_PROPERTY("WaveTableSelection", &nap::audio::Oscillator::mWaveTableSelection, nap::rtti::EPropertyMetaData::Required)
 RTTI_END_CLASS
@@ -73,6 +74,16 @@ namespace nap
                 if (mFmInput != nullptr)
                 {
                     node->fmInput.connect(*mFmInput->getInstance()->getOutputForChannel(channel % mFmInput->getInstance()->getChannelCount()));
+                }
+                if (mFmControlInput != nullptr)
+                {
+                    auto controlOutput = mFmControlInput->getInstance()->getControlOutputForChannel(channel % mFmControlInput->getInstance()->getChannelCount());
+                    if (controlOutput == nullptr)
+                    {
+                        errorState.fail("FmControlInput of Oscillator %s has no control rate output", mID.c_str());
+                        return nullptr;
+                    }
+                    node->fmControlInput.connect(*controlOutput);
                 }
 			}
 
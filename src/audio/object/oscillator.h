@@ -33,6 +33,13 @@ namespace nap
 
         public:
             WaveTableResource(Core& core);
+
+            /**
+             * Constructor that creates the wave table on a given node manager instead of the one of the AudioService.
+             * Used to create the resource in code, for example when processing offline without a running Core.
+             * @param nodeManager The node manager the wave table will be created on.
+             */
+            WaveTableResource(NodeManager& nodeManager) : Resource(), mNodeManager(&nodeManager) { }
             bool init(utility::ErrorState& errorState) override;
 
             int mSize = 2048;                                          ///< Property: 'Size' Size of the wavetable. Has to be a power of two.
@@ -62,6 +69,7 @@ namespace nap
             std::vector<ControllerValue> mFrequency = { 220.f }; ///< property: 'Frequency' array of frequency values that will be mapped on the oscillators on each channel
             std::vector<ControllerValue> mAmplitude = { 1.f }; ///< property: 'Amplitude' array of amplitude values that will be mapped on the oscillators on each channel
             ResourcePtr<AudioObject> mFmInput = nullptr; ///< property: 'FmInput' audio object of which the outputs will modulate the frequencies of the oscillators on each channel.
+            ResourcePtr<AudioObject> mFmControlInput = nullptr; ///< property: 'FmControlInput' audio object with a control rate output, like an Envelope, that modulates the frequencies of the oscillators on each channel. Added to the FmInput.
             std::vector<ResourcePtr<WaveTableResource>> mWaveTables; ///< property: 'WaveTables' Pointers to a collection of different wave table resources that can be chosen from at runtime.
 			int mWaveTableSelection = 0; ///< property: 'WaveTableIndex' Selection from the list of wavetables that will be used on initialization.
 			int mChannelCount = 1; ///< property: 'ChannelCount' Number of channels
@@ -4,9 +4,22 @@
 
 #include "sampler.h"
 
+// Std includes
+#include <map>
+
+RTTI_BEGIN_STRUCT(nap::audio::SamplePlayer::Zone)
+    RTTI_PROPERTY("Entry", &nap::audio::SamplePlayer::Zone::mEntry, nap::rtti::EPropertyMetaData::Required)
+    RTTI_PROPERTY("LowKey", &nap::audio::SamplePlayer::Zone::mLowKey, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("HighKey", &nap::audio::SamplePlayer::Zone::mHighKey, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("LowVelocity", &nap::audio::SamplePlayer::Zone::mLowVelocity, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("HighVelocity", &nap::audio::SamplePlayer::Zone::mHighVelocity, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("RootKey", &nap::audio::SamplePlayer::Zone::mRootKey, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_STRUCT
+
 RTTI_BEGIN_CLASS(nap::audio::SamplePlayer)
     RTTI_PROPERTY("SamplerEntries", &nap::audio::SamplePlayer::mSampleEntries, nap::rtti::EPropertyMetaData::Required)
     RTTI_PROPERTY("EnvelopeData", &nap::audio::SamplePlayer::mEnvelopeData, nap::rtti::EPropertyMetaData::Required)
+    RTTI_PROPERTY("Zones", &nap::audio::SamplePlayer::mZones, nap::rtti::EPropertyMetaData::Default)
     RTTI_PROPERTY("ChannelCount", &nap::audio::SamplePlayer::mChannelCount, nap::rtti::EPropertyMetaData::Default)
     RTTI_PROPERTY("VoiceCount", &nap::audio::SamplePlayer::mVoiceCount, nap::rtti::EPropertyMetaData::Default)
     RTTI_PROPERTY("EqualPowerTable", &nap::audio::SamplePlayer::mEqualPowerTable, nap::rtti::EPropertyMetaData::Required)
@@ -14,6 +27,7 @@ RTTI_END_CLASS
 
 RTTI_BEGIN_CLASS(nap::audio::SamplePlayerInstance)
     RTTI_FUNCTION("play", &nap::audio::SamplePlayerInstance::play)
+    RTTI_FUNCTION("playNote", &nap::audio::SamplePlayerInstance::playNote)
     RTTI_FUNCTION("stop", &nap::audio::SamplePlayerInstance::stop)
     RTTI_FUNCTION("getEnvelopeData", &nap::audio::SamplePlayerInstance::getEnvelopeData)
     RTTI_FUNCTION("getSamplerEntries", &nap::audio::SamplePlayerInstance::getSamplerEntries)
@@ -37,6 +51,8 @@ namespace nap
             auto instance = std::make_unique<SamplePlayerInstance>();
             if (!instance->init(mSampleEntries, mEqualPowerTable, mEnvelopeData, mChannelCount, mVoiceCount, nodeManager, errorState))
                 return nullptr;
+            if (!instance->setZones(mZones, errorState))
+                return nullptr;
             
             return std::move(instance);
         }
@@ -123,11 +139,99 @@ namespace nap
         }
 
         
+        bool SamplePlayerInstance::setZones(const SamplePlayer::Zones& zones, utility::ErrorState& errorState)
+        {
+            for (auto& zone : zones)
+            {
+                if (zone.mEntry < 0 || zone.mEntry >= mSamplerEntries.size())
+                {
+                    errorState.fail("Invalid SamplePlayer zone: entry %i does not exist", zone.mEntry);
+                    return false;
+                }
+                if (zone.mLowKey < 0 || zone.mHighKey > 127 || zone.mLowKey > zone.mHighKey)
+                {
+                    errorState.fail("Invalid SamplePlayer zone: invalid key range %i - %i", zone.mLowKey, zone.mHighKey);
+                    return false;
+                }
+                if (zone.mLowVelocity < 0 || zone.mHighVelocity > 127 || zone.mLowVelocity > zone.mHighVelocity)
+                {
+                    errorState.fail("Invalid SamplePlayer zone: invalid velocity range %i - %i", zone.mLowVelocity, zone.mHighVelocity);
+                    return false;
+                }
+                if (zone.mRootKey > 127)
+                {
+                    errorState.fail("Invalid SamplePlayer zone: invalid root key %i", zone.mRootKey);
+                    return false;
+                }
+            }
+
+            mZones = zones;
+            mZoneGroups.clear();
+            mGroupZones.clear();
+            mZoneTable.assign(128 * 128, -1);
+
+            // Every note and velocity gets the group of zones that contain it. Equal groups are shared, so their round-robin continues across notes.
+            std::map<std::vector<int>, int> groups;
+            std::vector<int> group;
+            for (auto note = 0; note < 128; ++note)
+                for (auto velocity = 0; velocity < 128; ++velocity)
+                {
+                    group.clear();
+                    for (auto i = 0; i < mZones.size(); ++i)
+                    {
+                        auto& zone = mZones[i];
+                        if (note >= zone.mLowKey && note <= zone.mHighKey && velocity >= zone.mLowVelocity && velocity <= zone.mHighVelocity)
+                            group.emplace_back(i);
+                    }
+                    if (group.empty())
+                        continue;
+
+                    auto it = groups.find(group);
+                    if (it == groups.end())
+                    {
+                        ZoneGroup zoneGroup;
+                        zoneGroup.mFirst = mGroupZones.size();
+                        zoneGroup.mCount = group.size();
+                        mGroupZones.insert(mGroupZones.end(), group.begin(), group.end());
+                        it = groups.emplace(group, mZoneGroups.size()).first;
+                        mZoneGroups.emplace_back(zoneGroup);
+                    }
+                    mZoneTable[note * 128 + velocity] = it->second;
+                }
+
+            return true;
+        }
+
+
         VoiceInstance* SamplePlayerInstance::play(unsigned int samplerEntryIndex, TimeValue duration)
         {
-            if (samplerEntryIndex > mSamplerEntries.size())
+            if (samplerEntryIndex >= mSamplerEntries.size())
+                return nullptr;
+
+            return playEntry(mSamplerEntries[samplerEntryIndex], 0.f, duration);
+        }
+
+
+        VoiceInstance* SamplePlayerInstance::playNote(int note, int velocity, TimeValue duration)
+        {
+            if (note < 0 || note > 127 || velocity < 0 || velocity > 127 || mZoneTable.empty())
                 return nullptr;
 
+            auto groupIndex = mZoneTable[note * 128 + velocity];
+            if (groupIndex < 0)
+                return nullptr;
+
+            auto& group = mZoneGroups[groupIndex];
+            auto& zone = mZones[mGroupZones[group.mFirst + group.mNext]];
+            group.mNext = (group.mNext + 1) % group.mCount;
+
+            ControllerValue transpose = (zone.mRootKey >= 0) ? ControllerValue(note - zone.mRootKey) : 0.f;
+            return playEntry(mSamplerEntries[zone.mEntry], transpose, duration);
+        }
+
+
+        VoiceInstance* SamplePlayerInstance::playEntry(const BufferLooper::Settings& entry, ControllerValue transpose, TimeValue duration)
+        {
             auto voice = mPolyphonicInstance->findFreeVoice();
 			if (voice == nullptr)
 			{
@@ -138,7 +242,7 @@ namespace nap
             auto& envelope = voice->getEnvelope();
 
             bufferLooper->reset();
-            bufferLooper->start(mSamplerEntries[samplerEntryIndex]);
+            bufferLooper->start(entry, transpose);
             envelope.setEnvelopeData(mEnvelopeData);
 
             mPolyphonicInstance->play(voice, duration);
@@ -4,7 +4,12 @@
 
 #pragma once
 
+// Std includes
+#include <cstdint>
+
 #include <audio/object/bufferlooper.h>
+#include <audio/object/multiply.h>
+#include <audio/core/polyphonic.h>
 
 namespace nap
 {
@@ -21,6 +26,23 @@ namespace nap
             
         public:
             using SamplerEntries = std::vector<BufferLooper::Settings>;
+
+            /**
+             * Maps a range of keys and velocities to a sampler entry.
+             * Zones that overlap form a round-robin group: notes within the overlap cycle through the overlapping zones.
+             */
+            class NAPAPI Zone
+            {
+            public:
+                int mEntry = 0;                 ///< Property: 'Entry' Index of the sampler entry that is played.
+                int mLowKey = 0;                ///< Property: 'LowKey' Lowest MIDI note number of the zone.
+                int mHighKey = 127;             ///< Property: 'HighKey' Highest MIDI note number of the zone.
+                int mLowVelocity = 0;           ///< Property: 'LowVelocity' Lowest velocity of the zone.
+                int mHighVelocity = 127;        ///< Property: 'HighVelocity' Highest velocity of the zone.
+                int mRootKey = -1;              ///< Property: 'RootKey' Note number that plays the entry untransposed, other notes are transposed relative to it. -1 disables transposition by key.
+            };
+
+            using Zones = std::vector<Zone>;
             
         public:
 			SamplePlayer() : AudioObject() { }
@@ -30,6 +52,7 @@ namespace nap
             
             SamplerEntries mSampleEntries;                              ///< Property: 'SampleEntries' Default set of different playback settings
             EnvelopeNode::Envelope mEnvelopeData;                       ///< Property: 'Envelope' Default envelope settings
+            Zones mZones;                                               ///< Property: 'Zones' Key and velocity zones used by SamplePlayerInstance::playNote()
             int mChannelCount = 1;                                      ///< Property: 'ChannelCount' Number of channels
             int mVoiceCount = 10;                                       ///< Property: 'VoiceCount' Number of voices in the pool.
             ResourcePtr<EqualPowerTable> mEqualPowerTable = nullptr;    ///< Property: 'EqualPowerTable' Pointer to EqualPowerTable that will be used by crossfades and envelopes.
@@ -66,6 +89,14 @@ namespace nap
             OutputPin* getOutputForChannel(int channel) override { return mPolyphonicInstance->getOutputForChannel(channel); }
             int getChannelCount() const override { return mPolyphonicInstance->getChannelCount(); }
 
+            /**
+             * Sets the key and velocity zones used by playNote() and compiles them into a lookup table.
+             * @param zones The zones
+             * @param errorState Contains error information if a zone is invalid
+             * @return True on success
+             */
+            bool setZones(const SamplePlayer::Zones& zones, utility::ErrorState& errorState);
+
              /**
               * Plays back sampler entry with given index for given duration.
               * @param samplerEntryIndex Index of the sampler entry metadata for playback
@@ -74,6 +105,16 @@ namespace nap
               */
             VoiceInstance* play(unsigned int samplerEntryIndex, TimeValue duration);
 
+            /**
+             * Plays the sampler entry of the zone that contains the note and velocity, see setZones().
+             * When multiple zones contain the note and velocity they are played in turn.
+             * @param note MIDI note number from 0 to 127
+             * @param velocity Velocity from 0 to 127
+             * @param duration Duration of the playback
+             * @return Voice that is playing back the entry, or nullptr if no zone contains the note or no voice is available
+             */
+            VoiceInstance* playNote(int note, int velocity, TimeValue duration = 0);
+
             /**
              * Plays a sampler entry, but specify the section of the envelope that will be played.
              * @param samplerEntryIndex Index of the sampler entry meta data
@@ -103,8 +144,23 @@ namespace nap
             EnvelopeNode::Envelope& getEnvelopeData() { return mEnvelopeData; }
             
         private:
+            // Zones containing the same notes and velocities, played in turn
+            struct ZoneGroup
+            {
+                int mFirst = 0;     // Index of the first zone in mGroupZones
+                int mCount = 0;
+                int mNext = 0;      // Round-robin index of the zone that plays next
+            };
+
+            VoiceInstance* playEntry(const BufferLooper::Settings& entry, ControllerValue transpose, TimeValue duration);
+
 			SamplePlayer::SamplerEntries mSamplerEntries;
             EnvelopeNode::Envelope mEnvelopeData;
+
+            SamplePlayer::Zones mZones;
+            std::vector<ZoneGroup> mZoneGroups;
+            std::vector<int> mGroupZones;               // Zone indices of all groups
+            std::vector<int16_t> mZoneTable;            // Group index for each note and velocity, -1 if no zone contains them
             
             std::unique_ptr<PolyphonicInstance> mPolyphonicInstance = nullptr;
             
@@ -0,0 +1,63 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "stringbank.h"
+
+// Std includes
+#include <algorithm>
+
+RTTI_BEGIN_CLASS(nap::audio::StringBank)
+    RTTI_PROPERTY("StringCount", &nap::audio::StringBank::mStringCount, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("MaxStringCount", &nap::audio::StringBank::mMaxStringCount, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("MaxDelayTime", &nap::audio::StringBank::mMaxDelayTime, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Frequencies", &nap::audio::StringBank::mFrequencies, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Feedback", &nap::audio::StringBank::mFeedback, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("Damping", &nap::audio::StringBank::mDamping, nap::rtti::EPropertyMetaData::Default)
+    RTTI_PROPERTY("InputGain", &nap::audio::StringBank::mInputGain, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::ParallelNodeObjectInstance<nap::audio::StringBankNode>)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        bool StringBank::initNode(int channel, StringBankNode& node, utility::ErrorState& errorState)
+        {
+            if (mStringCount <= 0)
+            {
+                errorState.fail("StringBank: StringCount has to be larger than 0: %s", mID.c_str());
+                return false;
+            }
+
+            if (mFrequencies.empty())
+            {
+                errorState.fail("StringBank: No frequencies specified: %s", mID.c_str());
+                return false;
+            }
+
+            if (mFeedback >= 1.f)
+            {
+                errorState.fail("StringBank: Feedback has to be lower than 1: %s", mID.c_str());
+                return false;
+            }
+
+            node.allocate(std::max(mStringCount, mMaxStringCount), mMaxDelayTime);
+            node.setStringCount(mStringCount);
+            for (auto string = 0; string < mStringCount; ++string)
+            {
+                node.setFrequency(string, mFrequencies[string % mFrequencies.size()]);
+                node.setFeedback(string, mFeedback);
+                node.setDamping(string, mDamping);
+                node.setInputGain(string, mInputGain);
+            }
+            return true;
+        }
+
+    }
+
+}
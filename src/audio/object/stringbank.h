@@ -0,0 +1,51 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+
+// Audio includes
+#include <audio/core/nodeobject.h>
+#include <audio/node/stringbanknode.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Object with a bank of Karplus strong strings on each channel, see StringBankNode.
+         * The strings are tuned to the frequencies property, which is repeated when there are more strings than frequencies.
+         */
+        class NAPAPI StringBank : public ParallelNodeObject<StringBankNode>
+        {
+            RTTI_ENABLE(ParallelNodeObjectBase)
+
+        public:
+            StringBank() = default;
+
+            int mStringCount = 8;                                   ///< Property: 'StringCount' Number of strings per channel.
+            int mMaxStringCount = 0;                                ///< Property: 'MaxStringCount' Number of strings per channel memory is allocated for, up to which StringBankNode::setStringCount() can raise the count at runtime. 0 means StringCount.
+            float mMaxDelayTime = 50.f;                             ///< Property: 'MaxDelayTime' Maximum delay time in ms, determines the lowest frequency.
+            std::vector<float> mFrequencies = { 110.f };            ///< Property: 'Frequencies' Frequencies of the strings in Hz.
+            float mFeedback = 0.99f;                                ///< Property: 'Feedback' Feedback multiplier of all strings, lower than 1.
+            float mDamping = 5000.f;                                ///< Property: 'Damping' Cutoff frequency in Hz of the lowpass filter in the feedback loops.
+            float mInputGain = 1.f;                                 ///< Property: 'InputGain' Gain of the audio input for all strings.
+
+        private:
+            bool initNode(int channel, StringBankNode& node, utility::ErrorState& errorState) override;
+        };
+
+
+        /**
+         * Instance of StringBank
+         */
+        using StringBankInstance = ParallelNodeObjectInstance<StringBankNode>;
+
+    }
+
+}
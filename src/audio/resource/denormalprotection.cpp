@@ -0,0 +1,66 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "denormalprotection.h"
+
+// Nap includes
+#include <nap/core.h>
+#include <nap/logger.h>
+
+// Audio includes
+#include <audio/core/audionodemanager.h>
+#include <audio/utility/denormals.h>
+
+RTTI_BEGIN_CLASS_NO_DEFAULT_CONSTRUCTOR(nap::audio::DenormalProtection)
+    RTTI_CONSTRUCTOR(nap::Core&)
+    RTTI_PROPERTY("FlushToZero", &nap::audio::DenormalProtection::mFlushToZero, nap::rtti::EPropertyMetaData::Default)
+RTTI_END_CLASS
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        FlushToZeroProcess::FlushToZeroProcess(NodeManager& nodeManager) : Process(nodeManager)
+        {
+            getNodeManager().registerRootProcess(*this);
+        }
+
+
+        FlushToZeroProcess::~FlushToZeroProcess()
+        {
+            getNodeManager().unregisterRootProcess(*this);
+        }
+
+
+        void FlushToZeroProcess::process()
+        {
+            enableFlushToZero();
+        }
+
+
+        DenormalProtection::DenormalProtection(Core& core) : Resource()
+        {
+            auto audioService = core.getService<AudioService>();
+            assert(audioService != nullptr);
+            mNodeManager = &audioService->getNodeManager();
+        }
+
+
+        bool DenormalProtection::init(utility::ErrorState& errorState)
+        {
+            if (!mFlushToZero)
+                return true;
+
+            if (!isFlushToZeroSupported())
+                Logger::warn("%s: Flush to zero is not supported on this platform.", mID.c_str());
+
+            mProcess = mNodeManager->makeSafe<FlushToZeroProcess>(*mNodeManager);
+            return true;
+        }
+
+    }
+
+}
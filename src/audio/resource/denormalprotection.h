@@ -0,0 +1,68 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <nap/resource.h>
+
+// Audio includes
+#include <audio/core/audionode.h>
+#include <audio/utility/safeptr.h>
+#include <audio/service/audioservice.h>
+
+namespace nap
+{
+
+    // Forward declarations
+    class Core;
+
+    namespace audio
+    {
+
+        /**
+         * Root process that enables flush to zero on the thread that processes it, see enableFlushToZero().
+         */
+        class NAPAPI FlushToZeroProcess : public Process
+        {
+        public:
+            FlushToZeroProcess(NodeManager& nodeManager);
+            ~FlushToZeroProcess() override;
+
+        private:
+            void process() override;
+        };
+
+
+        /**
+         * Resource that makes the audio thread flush denormal numbers to zero, which keeps feedback loops like reverbs, delays and strings from slowing down when they decay to silence.
+         * The setting is applied at the start of every processed buffer, so it is also in place after the audio device has been restarted on a new thread.
+         * Threads that process audio outside of the node manager, for example offline rendering, can use ScopedFlushToZero.
+         */
+        class NAPAPI DenormalProtection : public Resource
+        {
+            RTTI_ENABLE(Resource)
+
+        public:
+            DenormalProtection(Core& core);
+
+            /**
+             * Constructor that registers the protection on a given node manager instead of the one of the AudioService.
+             * @param nodeManager The node manager whose processing thread flushes denormals to zero.
+             */
+            DenormalProtection(NodeManager& nodeManager) : Resource(), mNodeManager(&nodeManager) { }
+
+            // Inherited from Resource
+            bool init(utility::ErrorState& errorState) override;
+
+            bool mFlushToZero = true; ///< Property: 'FlushToZero' Enables flush to zero on the audio thread. When false or unsupported the feedback loops of the module still round their state to zero.
+
+        private:
+            NodeManager* mNodeManager = nullptr;
+            SafeOwner<FlushToZeroProcess> mProcess = nullptr;
+        };
+
+    }
+
+}
@@ -31,6 +31,13 @@ namespace nap
         public:
             EqualPowerTable(Core& core);
 
+            /**
+             * Constructor that creates the table on a given node manager instead of the one of the AudioService.
+             * Used to create the resource in code, for example when processing offline without a running Core.
+             * @param nodeManager The node manager the table will be created on.
+             */
+            EqualPowerTable(NodeManager& nodeManager) : Resource(), mNodeManager(&nodeManager) { }
+
             // Inherited from Resource
             bool init(utility::ErrorState& errorState) override;
 
@@ -6,6 +6,7 @@
 
 #include <cassert>
 #include <audio/utility/audiotypes.h>
+#include <audio/utility/denormals.h>
 
 #include <atomic>
 
@@ -52,7 +53,7 @@ namespace nap
 				int readIndex = mBufferIndex - mDelay;
 				if (readIndex < 0)
 					readIndex += mInputBuffer.size();
-				SampleValue output = -mGain * input + mInputBuffer[readIndex] + mGain * mOutputBuffer[readIndex];
+				SampleValue output = flushDenormal(-mGain * input + mInputBuffer[readIndex] + mGain * mOutputBuffer[readIndex]);
 				mInputBuffer[mBufferIndex] = input;
 				mOutputBuffer[mBufferIndex] = output;
 				mBufferIndex++;
@@ -15,8 +15,8 @@ namespace nap
     {
         
         /**
-         * Helper object to calculate a multiple of 4 or 8 biquad filters simultaneously with SSE or AVX vector extensions using @float4 or @float8.
-         * @tparam real Should be float, @float4 or @float8.
+         * Helper object to calculate a multiple of 4, 8 or 16 biquad filters simultaneously with SSE, AVX or AVX-512 vector extensions using @float4, @float8 or @float16.
+         * @tparam real Should be float, @float4, @float8 or @float16.
          */
         template <typename real>
         class NAPAPI BiquadFilter
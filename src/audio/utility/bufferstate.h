@@ -0,0 +1,64 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Describes the contents of a buffer, used by nodes to take fast paths for inputs that are silent or constant.
+         */
+        enum class BufferState
+        {
+            Silent,     ///< All samples are zero
+            Constant,   ///< All samples have the same value, which is not zero
+            Varying     ///< The samples differ
+        };
+
+
+        /**
+         * Scans a buffer to find out whether it is silent or constant.
+         * The scan stops at the first sample that differs from the first one, so for an audio signal it usually only costs a few comparisons.
+         * @param buffer The buffer to be scanned.
+         * @param value Receives the value of the samples if the buffer is silent or constant.
+         * @return The state of the buffer.
+         */
+        inline BufferState getBufferState(const SampleBuffer& buffer, SampleValue& value)
+        {
+            if (buffer.empty())
+            {
+                value = 0.f;
+                return BufferState::Silent;
+            }
+
+            value = buffer[0];
+            for (auto i = 1; i < buffer.size(); ++i)
+                if (buffer[i] != value)
+                    return BufferState::Varying;
+
+            return (value == 0.f) ? BufferState::Silent : BufferState::Constant;
+        }
+
+
+        /**
+         * @return True if all samples in the buffer are zero.
+         */
+        inline bool isSilent(const SampleBuffer& buffer)
+        {
+            for (auto& sample : buffer)
+                if (sample != 0.f)
+                    return false;
+            return true;
+        }
+
+    }
+
+}
@@ -0,0 +1,244 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <algorithm>
+#include <cmath>
+
+// Nap includes
+#include <mathutils.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+#include <audio/utility/biquad.h>
+#include <audio/utility/karplusstrong.h>
+#include <audio/utility/linearsmoothedvalue.h>
+#include <audio/utility/onepole.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Kernels are the per sample stages of a FusedChainNode.
+         * A kernel is default constructible and has two methods that are called on the audio thread:
+         * - void setSampleRate(float sampleRate): called on construction of the node and when the sample rate changes.
+         * - SampleValue process(SampleValue input): processes one sample.
+         * The parameter setters of the kernels below also have to be called on the audio thread, use FusedChainNode::update().
+         */
+
+
+        /**
+         * Kernel that applies a one pole lowpass filter, see OnePoleLowPass.
+         */
+        class OnePoleLowPassKernel
+        {
+        public:
+            void setSampleRate(float sampleRate)
+            {
+                mSampleRate = sampleRate;
+                mFilter.setCutoffFrequency(mCutoffFrequency, mSampleRate);
+            }
+
+            SampleValue process(SampleValue input) { return mFilter.process(input); }
+
+            /**
+             * @param frequency Cutoff frequency in Hz
+             */
+            void setCutoffFrequency(ControllerValue frequency)
+            {
+                mCutoffFrequency = frequency;
+                mFilter.setCutoffFrequency(mCutoffFrequency, mSampleRate);
+            }
+
+        private:
+            OnePoleLowPass<float> mFilter;
+            ControllerValue mCutoffFrequency = 20000.f;
+            float mSampleRate = 44100.f;
+        };
+
+
+        /**
+         * Kernel that applies a one pole highpass filter, see OnePoleHighPass.
+         */
+        class OnePoleHighPassKernel
+        {
+        public:
+            void setSampleRate(float sampleRate)
+            {
+                mSampleRate = sampleRate;
+                mFilter.setCutoffFrequency(mCutoffFrequency, mSampleRate);
+            }
+
+            SampleValue process(SampleValue input) { return mFilter.process(input); }
+
+            /**
+             * @param frequency Cutoff frequency in Hz
+             */
+            void setCutoffFrequency(ControllerValue frequency)
+            {
+                mCutoffFrequency = frequency;
+                mFilter.setCutoffFrequency(mCutoffFrequency, mSampleRate);
+            }
+
+        private:
+            OnePoleHighPass<float> mFilter;
+            ControllerValue mCutoffFrequency = 20.f;
+            float mSampleRate = 44100.f;
+        };
+
+
+        /**
+         * Kernel that applies a biquad filter, see BiquadFilter. Coefficient changes are interpolated by the filter.
+         */
+        class BiquadKernel
+        {
+        public:
+            enum class Mode { LowPass, HighPass, BandPass };
+
+            void setSampleRate(float sampleRate)
+            {
+                mSampleRate = sampleRate;
+                update();
+            }
+
+            SampleValue process(SampleValue input) { return mFilter.process(input); }
+
+            /**
+             * Sets the filter response.
+             * @param mode Lowpass, highpass or bandpass.
+             * @param frequency Cutoff frequency or center frequency in Hz.
+             * @param q Resonance of the lowpass and highpass, or the center frequency divided by the bandwidth for the bandpass.
+             * @param gain Output gain.
+             */
+            void setParameters(Mode mode, ControllerValue frequency, ControllerValue q, ControllerValue gain = 1.f)
+            {
+                mMode = mode;
+                mFrequency = frequency;
+                mQ = std::max(q, 0.01f);
+                mGain = gain;
+                update();
+            }
+
+        private:
+            // Coefficients from the audio EQ cookbook by Robert Bristow-Johnson
+            void update()
+            {
+                float omega = math::PIX2 * std::min(mFrequency, 0.49f * mSampleRate) / mSampleRate;
+                float alpha = std::sin(omega) / (2.f * mQ);
+                float cosine = std::cos(omega);
+                float norm = 1.f / (1.f + alpha);
+                float b1 = -2.f * cosine * norm;
+                float b2 = (1.f - alpha) * norm;
+                switch (mMode)
+                {
+                    case Mode::LowPass:
+                        mFilter.setCoefficients(0.5f * (1.f - cosine) * norm, (1.f - cosine) * norm, 0.5f * (1.f - cosine) * norm, b1, b2, mGain);
+                        break;
+                    case Mode::HighPass:
+                        mFilter.setCoefficients(0.5f * (1.f + cosine) * norm, -(1.f + cosine) * norm, 0.5f * (1.f + cosine) * norm, b1, b2, mGain);
+                        break;
+                    case Mode::BandPass:
+                        mFilter.setCoefficients(alpha * norm, 0.f, -alpha * norm, b1, b2, mGain);
+                        break;
+                }
+            }
+
+            BiquadFilter<float> mFilter;
+            Mode mMode = Mode::LowPass;
+            ControllerValue mFrequency = 20000.f;
+            ControllerValue mQ = 0.707f;
+            ControllerValue mGain = 1.f;
+            float mSampleRate = 44100.f;
+        };
+
+
+        /**
+         * Kernel that applies a Karplus strong string model to its input, see KarplusStrong.
+         * The delay line is allocated on construction.
+         */
+        class KarplusStrongKernel
+        {
+        public:
+            static constexpr int maxDelay = 4096; ///< Maximum delay in samples, determines the lowest frequency.
+
+            KarplusStrongKernel()
+            {
+                mString.reset(maxDelay);
+                mString.setFeedback(mFeedback);
+            }
+
+            void setSampleRate(float sampleRate)
+            {
+                mSampleRate = sampleRate;
+                mString.setDamping(mDamping, mSampleRate);
+                setFrequency(mFrequency, 0);
+            }
+
+            SampleValue process(SampleValue input) { return mString.processPositive(input); }
+
+            /**
+             * @param frequency Pitch of the string in Hz.
+             * @param stepCount Number of samples to glide to the new pitch.
+             */
+            void setFrequency(ControllerValue frequency, int stepCount = 0)
+            {
+                mFrequency = frequency;
+                float delay = std::min(mSampleRate / std::max(frequency, 1.f), float(maxDelay - 2));
+                mString.setDelayTime(delay, stepCount);
+            }
+
+            /**
+             * @param feedback Feedback of the string, lower than 1.
+             */
+            void setFeedback(ControllerValue feedback)
+            {
+                mFeedback = std::min(feedback, 0.9999f);
+                mString.setFeedback(mFeedback);
+            }
+
+            /**
+             * @param frequency Cutoff frequency in Hz of the damping filter in the feedback loop.
+             */
+            void setDamping(ControllerValue frequency)
+            {
+                mDamping = frequency;
+                mString.setDamping(mDamping, mSampleRate);
+            }
+
+        private:
+            KarplusStrong<float> mString;
+            ControllerValue mFrequency = 440.f;
+            ControllerValue mFeedback = 0.99f;
+            ControllerValue mDamping = 5000.f;
+            float mSampleRate = 44100.f;
+        };
+
+
+        /**
+         * Kernel that multiplies its input with a gain that is interpolated over 64 samples.
+         */
+        class GainKernel
+        {
+        public:
+            void setSampleRate(float sampleRate) { }
+
+            SampleValue process(SampleValue input) { return input * mGain.getNextValue(); }
+
+            /**
+             * @param gain Gain multiplier.
+             */
+            void setGain(ControllerValue gain) { mGain.setValue(gain); }
+
+        private:
+            LinearSmoothedValue<ControllerValue> mGain = { 1.f, 64 };
+        };
+
+    }
+
+}
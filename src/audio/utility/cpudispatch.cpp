@@ -0,0 +1,108 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "cpudispatch.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            bool detect(InstructionSet instructionSet)
+            {
+                int info[4];
+                __cpuid(info, 0);
+                if (info[0] < 7)
+                    return false;
+
+                // The operating system has to save the extended registers on a context switch
+                __cpuid(info, 1);
+                bool osxsave = (info[2] & (1 << 27)) != 0;
+                bool fma = (info[2] & (1 << 12)) != 0;
+                if (!osxsave)
+                    return false;
+                auto xcr0 = _xgetbv(0);
+
+                __cpuidex(info, 7, 0);
+                bool avx2 = (info[1] & (1 << 5)) != 0;
+                bool avx512f = (info[1] & (1 << 16)) != 0;
+                bool avx512vl = (info[1] & (1 << 31)) != 0;
+
+                switch (instructionSet)
+                {
+                    case InstructionSet::Baseline:
+                        return true;
+                    case InstructionSet::AVX2:
+                        return (xcr0 & 0x6) == 0x6 && avx2 && fma;
+                    case InstructionSet::AVX512:
+                        return (xcr0 & 0xe6) == 0xe6 && avx2 && fma && avx512f && avx512vl;
+                }
+                return false;
+            }
+#elif defined(__x86_64__) || defined(__i386__)
+            bool detect(InstructionSet instructionSet)
+            {
+                // Also checks whether the operating system saves the extended registers
+                __builtin_cpu_init();
+                switch (instructionSet)
+                {
+                    case InstructionSet::Baseline:
+                        return true;
+                    case InstructionSet::AVX2:
+                        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+                    case InstructionSet::AVX512:
+                        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl");
+                }
+                return false;
+            }
+#else
+            bool detect(InstructionSet instructionSet)
+            {
+                return instructionSet == InstructionSet::Baseline;
+            }
+#endif
+
+        }
+
+
+        bool isSupported(InstructionSet instructionSet)
+        {
+            return detect(instructionSet);
+        }
+
+
+        InstructionSet getInstructionSet()
+        {
+            static const InstructionSet result = isSupported(InstructionSet::AVX512) ? InstructionSet::AVX512 : (isSupported(InstructionSet::AVX2) ? InstructionSet::AVX2 : InstructionSet::Baseline);
+            return result;
+        }
+
+
+        const char* getInstructionSetName(InstructionSet instructionSet)
+        {
+            switch (instructionSet)
+            {
+                case InstructionSet::Baseline:
+                    return "baseline";
+                case InstructionSet::AVX2:
+                    return "AVX2";
+                case InstructionSet::AVX512:
+                    return "AVX-512";
+            }
+            return "unknown";
+        }
+
+    }
+
+}
@@ -0,0 +1,44 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <utility/dllexport.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Instruction sets that the vector kernels are compiled for, see VectorKernels.
+         */
+        enum class InstructionSet
+        {
+            Baseline,   ///< The instruction set of the build flags of the module, SSE2 on x86-64.
+            AVX2,       ///< AVX2 and FMA.
+            AVX512      ///< AVX-512 foundation and vector length extensions.
+        };
+
+
+        /**
+         * @return Whether the processor and the operating system support an instruction set.
+         */
+        NAPAPI bool isSupported(InstructionSet instructionSet);
+
+        /**
+         * @return The most extended instruction set supported by the processor, detected once.
+         */
+        NAPAPI InstructionSet getInstructionSet();
+
+        /**
+         * @return The name of an instruction set, for logging.
+         */
+        NAPAPI const char* getInstructionSetName(InstructionSet instructionSet);
+
+    }
+
+}
@@ -0,0 +1,107 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "denormals.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define NAP_AUDIO_SSE_CONTROL
+#include <xmmintrin.h>
+#elif (defined(__aarch64__) || defined(__arm__)) && (defined(__GNUC__) || defined(__clang__))
+#define NAP_AUDIO_ARM_CONTROL
+#endif
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+
+#if defined(NAP_AUDIO_SSE_CONTROL)
+            constexpr uint64_t flushToZeroBits = 0x8040; // Flush to zero (bit 15) and denormals are zero (bit 6) in MXCSR
+
+            uint64_t getState() { return _mm_getcsr(); }
+            void setState(uint64_t state) { _mm_setcsr(static_cast<unsigned int>(state)); }
+#elif defined(NAP_AUDIO_ARM_CONTROL)
+            constexpr uint64_t flushToZeroBits = 1 << 24; // Flush to zero bit in FPCR or FPSCR
+
+    #if defined(__aarch64__)
+            uint64_t getState()
+            {
+                uint64_t state;
+                asm volatile("mrs %0, fpcr" : "=r"(state));
+                return state;
+            }
+
+            void setState(uint64_t state) { asm volatile("msr fpcr, %0" : : "r"(state)); }
+    #else
+            uint64_t getState()
+            {
+                uint32_t state;
+                asm volatile("vmrs %0, fpscr" : "=r"(state));
+                return state;
+            }
+
+            void setState(uint64_t state) { asm volatile("vmsr fpscr, %0" : : "r"(static_cast<uint32_t>(state))); }
+    #endif
+#endif
+
+        }
+
+
+        bool enableFlushToZero()
+        {
+#if defined(NAP_AUDIO_SSE_CONTROL) || defined(NAP_AUDIO_ARM_CONTROL)
+            auto state = getState();
+            if ((state & flushToZeroBits) != flushToZeroBits)
+                setState(state | flushToZeroBits);
+            return true;
+#else
+            return false;
+#endif
+        }
+
+
+        bool isFlushToZeroSupported()
+        {
+#if defined(NAP_AUDIO_SSE_CONTROL) || defined(NAP_AUDIO_ARM_CONTROL)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+
+        bool isFlushToZeroEnabled()
+        {
+#if defined(NAP_AUDIO_SSE_CONTROL) || defined(NAP_AUDIO_ARM_CONTROL)
+            return (getState() & flushToZeroBits) == flushToZeroBits;
+#else
+            return false;
+#endif
+        }
+
+
+        ScopedFlushToZero::ScopedFlushToZero()
+        {
+#if defined(NAP_AUDIO_SSE_CONTROL) || defined(NAP_AUDIO_ARM_CONTROL)
+            mPreviousState = getState();
+            mSupported = enableFlushToZero();
+#endif
+        }
+
+
+        ScopedFlushToZero::~ScopedFlushToZero()
+        {
+#if defined(NAP_AUDIO_SSE_CONTROL) || defined(NAP_AUDIO_ARM_CONTROL)
+            if (mSupported)
+                setState(mPreviousState);
+#endif
+        }
+
+    }
+
+}
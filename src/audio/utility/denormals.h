@@ -0,0 +1,87 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <cmath>
+#include <cstdint>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Makes the processor treat denormal floating point numbers as zero on the calling thread: flush to zero and denormals are zero on x86, flush to zero on ARM.
+         * Feedback loops that decay towards silence produce denormals, which are up to a hundred times slower to compute on x86.
+         * The setting is per thread, so it has to be enabled on every thread that processes audio. The DenormalProtection resource does this for the audio thread, NestedNodeManagerNode for its asynchronous worker.
+         * @return False if the platform does not support it.
+         */
+        NAPAPI bool enableFlushToZero();
+
+        /**
+         * @return True if the platform supports flushing denormals to zero.
+         */
+        NAPAPI bool isFlushToZeroSupported();
+
+        /**
+         * @return True if denormals are flushed to zero on the calling thread.
+         */
+        NAPAPI bool isFlushToZeroEnabled();
+
+
+        /**
+         * Enables flush to zero on the calling thread for the lifetime of the object and restores the previous setting afterwards.
+         * Use it on worker threads that process audio, or around offline processing.
+         */
+        class NAPAPI ScopedFlushToZero
+        {
+        public:
+            ScopedFlushToZero();
+            ~ScopedFlushToZero();
+
+            ScopedFlushToZero(const ScopedFlushToZero&) = delete;
+            ScopedFlushToZero& operator=(const ScopedFlushToZero&) = delete;
+
+        private:
+            uint64_t mPreviousState = 0;
+            bool mSupported = false;
+        };
+
+
+        /**
+         * Magnitude below which flushDenormal() sets a float to zero, about -300dB.
+         */
+        constexpr float denormalThreshold = 1e-15f;
+
+        /**
+         * Returns zero when the magnitude of the value is below denormalThreshold and the value otherwise.
+         * Used on the state of feedback loops as a fallback for threads and platforms where flush to zero is not enabled.
+         * Decaying feedback reaches exactly zero this way, so checks for silence also work on loops with feedback close to 1.
+         * Compiles to a compare and a mask without a branch.
+         */
+        inline float flushDenormal(float value)
+        {
+            return (std::abs(value) < denormalThreshold) ? 0.f : value;
+        }
+
+        /**
+         * Vector version of flushDenormal(float) for float4, float8 and float16, which have no comparison operators.
+         * Adding and subtracting a small constant rounds every lane below about 1e-22 to a multiple of the rounding step, which is far above the denormal range.
+         * Costs two additions and no branch. Note that compiling with -ffast-math can remove the rounding.
+         */
+        template <typename real>
+        inline real flushDenormal(const real& value)
+        {
+            return (value + real(1e-15f)) - real(1e-15f);
+        }
+
+    }
+
+}
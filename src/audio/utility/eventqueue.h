@@ -0,0 +1,116 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+#include <algorithm>
+
+// Nap includes
+#include <utility/threading.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Queue of events that are timestamped with an absolute sample time of the NodeManager.
+         * Events are enqueued by a single control thread and consumed by a node on the audio thread, where they can be applied at the exact sample within the buffer being processed.
+         * All memory is allocated on construction so the audio thread never allocates.
+         * @tparam EventType Type describing the event. Needs to be copyable and default constructible.
+         */
+        template <typename EventType>
+        class ScheduledEventQueue
+        {
+        public:
+            /**
+             * Constructor
+             * @param capacity Maximum number of events that can be scheduled at the same time. Events enqueued when the queue is full will be dropped.
+             */
+            ScheduledEventQueue(unsigned int capacity) : mQueue(capacity)
+            {
+                mPending.reserve(capacity);
+            }
+
+            /**
+             * Schedules an event. Called from the control thread.
+             * @param time Absolute sample time at which the event has to be applied. Events scheduled in the past will be applied at the start of the next processed buffer.
+             * @param event The event.
+             * @return False if the queue was full and the event was dropped.
+             */
+            bool enqueue(DiscreteTimeValue time, const EventType& event)
+            {
+                return mQueue.try_enqueue(Entry { time, event });
+            }
+
+            /**
+             * Moves newly enqueued events into the time ordered list of pending events.
+             * Has to be called on the audio thread at the start of each processed buffer.
+             */
+            void update()
+            {
+                Entry entry;
+                while (mPending.size() < mPending.capacity() && mQueue.try_dequeue(entry))
+                {
+                    auto position = std::upper_bound(mPending.begin(), mPending.end(), entry.mTime, [](DiscreteTimeValue time, const Entry& pending) { return time < pending.mTime; });
+                    mPending.insert(position, entry);
+                }
+            }
+
+            /**
+             * Pops the first pending event that is due at the given time. Called on the audio thread.
+             * @param time Current absolute sample time.
+             * @param event Receives the popped event.
+             * @return True if an event was due and has been popped.
+             */
+            bool pop(DiscreteTimeValue time, EventType& event)
+            {
+                if (mPending.empty() || mPending.front().mTime > time)
+                    return false;
+                event = mPending.front().mEvent;
+                mPending.erase(mPending.begin());
+                return true;
+            }
+
+            /**
+             * Called on the audio thread.
+             * @param bufferStartTime Absolute sample time of the first sample in the buffer being processed.
+             * @param bufferSize Size of the buffer being processed.
+             * @return The offset within the buffer of the first pending event or bufferSize if no event is due within the buffer.
+             */
+            int getNextEventOffset(DiscreteTimeValue bufferStartTime, int bufferSize) const
+            {
+                if (mPending.empty())
+                    return bufferSize;
+                auto time = mPending.front().mTime;
+                if (time <= bufferStartTime)
+                    return 0;
+                return int(std::min<DiscreteTimeValue>(time - bufferStartTime, bufferSize));
+            }
+
+            /**
+             * @return True if there are no pending events. Called on the audio thread.
+             */
+            bool isEmpty() const { return mPending.empty(); }
+
+        private:
+            struct Entry
+            {
+                DiscreteTimeValue mTime = 0;
+                EventType mEvent;
+            };
+
+            moodycamel::ReaderWriterQueue<Entry> mQueue;
+            std::vector<Entry> mPending;
+        };
+
+    }
+
+}
@@ -4,6 +4,10 @@
 
 #pragma once
 
+// Std includes
+#include <atomic>
+#include <type_traits>
+
 // Nap includes
 #include <nap/signalslot.h>
 
@@ -17,6 +21,7 @@ namespace nap
          * Used to smooth changed to a value linearly over time, using a fixed smoothing time.
          * A slightly optimized version to the LinearSmoothedValue in modnapaudio.
          * Pitfall is that the update() method has to be called manually each audio callback.
+         * For vector types like float8 setValue() has to be called from the audio thread as well, their atomics are not lock free.
          */
         template <typename T>
         class FastLinearSmoothedValue
@@ -57,9 +62,10 @@ namespace nap
              */
             void update()
             {
-                if (mNewDestination != mDestination)
+                T newDestination = mNewDestination;
+                if (newDestination != mDestination)
                 {
-                    mDestination = mNewDestination;
+                    mDestination = newDestination;
                     mStepCounter = mStepCount;
                     if (mStepCounter == 0)
                         mValue = mDestination;
@@ -104,10 +110,10 @@ namespace nap
              * Should only be called from the audio thread.
              * @return True when currently playing a ramp.
              */
-            inline bool isRamping() const { return mStepCounter > 0 || mDestination != mNewDestination; }
+            inline bool isRamping() const { return mStepCounter > 0 || T(mNewDestination) != mDestination; }
             
         private:
-            std::atomic<T> mNewDestination = 0;
+            std::conditional_t<std::is_arithmetic<T>::value, std::atomic<T>, T> mNewDestination = { T(0) };
             
             T mValue; // Value that is being controlled by this object.
             T mIncrement; // Increment value per step of the current ramp when mode is linear.
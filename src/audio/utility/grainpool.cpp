@@ -0,0 +1,223 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "grainpool.h"
+
+// Std includes
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+
+// Nap includes
+#include <mathutils.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+            std::vector<float> createWindowTable(const std::function<double(double)>& function)
+            {
+                std::vector<float> result(GrainPool::windowTableSize + 1);
+                for (auto i = 0; i <= GrainPool::windowTableSize; ++i)
+                    result[i] = function(double(i) / GrainPool::windowTableSize);
+                return result;
+            }
+
+
+            float sumLanes(const float8& value)
+            {
+                return ((value[0] + value[1]) + (value[2] + value[3])) + ((value[4] + value[5]) + (value[6] + value[7]));
+            }
+        }
+
+
+        GrainPool::GrainPool(int maxGrainCount) : mMaxGrainCount(maxGrainCount)
+        {
+            assert(maxGrainCount > 0);
+            auto paddedCount = ((maxGrainCount + laneCount - 1) / laneCount) * laneCount;
+            mPositions.resize(paddedCount, 0.0);
+            mSpeeds.resize(paddedCount, 0.f);
+            mPhases.resize(paddedCount, 0.f);
+            mIncrements.resize(paddedCount, 0.f);
+            mGains.resize(paddedCount, 0.f);
+
+            // Make sure the tables are created before processing starts
+            getWindowTable(GrainWindow::Hann);
+        }
+
+
+        bool GrainPool::start(double position, float speed, float gain, int duration, int delay)
+        {
+            if (mGrainCount >= mMaxGrainCount || duration <= 0)
+                return false;
+
+            // The grain is moved back by its delay, so it arrives at the given position and at the start of its window after the delay.
+            auto grain = mGrainCount++;
+            auto increment = 1.f / duration;
+            mPositions[grain] = position - double(delay) * speed;
+            mSpeeds[grain] = speed;
+            mPhases[grain] = -delay * increment;
+            mIncrements[grain] = increment;
+            mGains[grain] = gain;
+            return true;
+        }
+
+
+        void GrainPool::clear()
+        {
+            for (auto grain = 0; grain < mGrainCount; ++grain)
+            {
+                mGains[grain] = 0.f;
+                mIncrements[grain] = 0.f;
+            }
+            mGrainCount = 0;
+        }
+
+
+        void GrainPool::process(const SampleValue* source, int sourceSize, bool circular, SampleValue* output, int sampleCount, GrainWindow window)
+        {
+            const float* windowTable = getWindowTable(window).data();
+            if (circular)
+            {
+                assert(sourceSize > 0 && (sourceSize & (sourceSize - 1)) == 0);
+                process<true>(source, sourceSize, output, sampleCount, windowTable);
+            }
+            else
+                process<false>(source, sourceSize, output, sampleCount, windowTable);
+
+            removeFinishedGrains();
+        }
+
+
+        template <bool circular>
+        void GrainPool::process(const SampleValue* source, int sourceSize, SampleValue* output, int sampleCount, const float* window)
+        {
+            const unsigned long long mask = sourceSize - 1;
+            const unsigned long long size = sourceSize;
+            const int groupCount = (mGrainCount + laneCount - 1) / laneCount;
+
+            alignas(32) float x0[laneCount];
+            alignas(32) float x1[laneCount];
+            alignas(32) float fractions[laneCount];
+            alignas(32) float amplitudes[laneCount];
+
+            for (auto i = 0; i < sampleCount; ++i)
+            {
+                float8 sum(0.f);
+
+                for (auto group = 0; group < groupCount; ++group)
+                {
+                    const int first = group * laneCount;
+
+                    // Gather the window values and the samples around the position of each lane
+                    for (auto lane = 0; lane < laneCount; ++lane)
+                    {
+                        auto grain = first + lane;
+
+                        float phase = mPhases[grain];
+                        if (phase > 0.f && phase < 1.f)
+                        {
+                            float tablePosition = phase * windowTableSize;
+                            int tableIndex = int(tablePosition);
+                            float tableFraction = tablePosition - tableIndex;
+                            amplitudes[lane] = window[tableIndex] + tableFraction * (window[tableIndex + 1] - window[tableIndex]);
+                        }
+                        else
+                            amplitudes[lane] = 0.f;
+
+                        double position = mPositions[grain];
+                        double floor = std::floor(position);
+                        auto index = (unsigned long long)(long long)floor;
+                        fractions[lane] = float(position - floor);
+                        if (circular)
+                        {
+                            x0[lane] = source[index & mask];
+                            x1[lane] = source[(index + 1) & mask];
+                        }
+                        else {
+                            // Negative indices wrap to large unsigned values and read silence as well
+                            x0[lane] = index < size ? source[index] : 0.f;
+                            x1[lane] = index + 1 < size ? source[index + 1] : 0.f;
+                        }
+                    }
+
+                    // Interpolate and apply window and gain to all lanes at once
+                    float8 a(x0);
+                    float8 b(x1);
+                    float8 value = a + float8(fractions) * (b - a);
+                    sum = sum + value * float8(amplitudes) * float8(&mGains[first]);
+
+                    for (auto lane = 0; lane < laneCount; ++lane)
+                    {
+                        auto grain = first + lane;
+                        mPositions[grain] += mSpeeds[grain];
+                        mPhases[grain] += mIncrements[grain];
+                    }
+                }
+
+                output[i] = sumLanes(sum);
+            }
+        }
+
+
+        void GrainPool::removeFinishedGrains()
+        {
+            // Finished grains are replaced by the last grain, so the playing grains stay at the start of the pool
+            auto grain = 0;
+            while (grain < mGrainCount)
+            {
+                if (mPhases[grain] >= 1.f)
+                {
+                    auto last = --mGrainCount;
+                    mPositions[grain] = mPositions[last];
+                    mSpeeds[grain] = mSpeeds[last];
+                    mPhases[grain] = mPhases[last];
+                    mIncrements[grain] = mIncrements[last];
+                    mGains[grain] = mGains[last];
+                    mGains[last] = 0.f;
+                    mIncrements[last] = 0.f;
+                }
+                else
+                    grain++;
+            }
+        }
+
+
+        const std::vector<float>& GrainPool::getWindowTable(GrainWindow window)
+        {
+            static const std::vector<float> hann = createWindowTable([](double x){ return 0.5 - 0.5 * std::cos(math::PIX2 * x); });
+            static const std::vector<float> triangle = createWindowTable([](double x){ return 1.0 - std::abs(2.0 * x - 1.0); });
+            static const std::vector<float> tukey = createWindowTable([](double x){
+                // Cosine fades over the first and last quarter
+                auto distance = std::min(x, 1.0 - x);
+                return distance >= 0.25 ? 1.0 : 0.5 - 0.5 * std::cos(math::PI * distance / 0.25);
+            });
+            static const std::vector<float> gaussian = createWindowTable([](double x){
+                // Shifted and scaled to start and end at zero
+                auto edge = std::exp(-0.5 * 9.0);
+                auto value = std::exp(-0.5 * std::pow((x - 0.5) * 6.0, 2.0));
+                return (value - edge) / (1.0 - edge);
+            });
+
+            switch (window)
+            {
+                case GrainWindow::Triangle:
+                    return triangle;
+                case GrainWindow::Tukey:
+                    return tukey;
+                case GrainWindow::Gaussian:
+                    return gaussian;
+                default:
+                    return hann;
+            }
+        }
+
+    }
+
+}
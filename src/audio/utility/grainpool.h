@@ -0,0 +1,110 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+#include <audio/utility/vectorextension.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Shape of the amplitude window of a grain.
+         */
+        enum class GrainWindow
+        {
+            Hann,       ///< Raised cosine over the whole grain
+            Triangle,   ///< Linear fade in and fade out
+            Tukey,      ///< Cosine fades over the first and last quarter of the grain with a flat top in between
+            Gaussian    ///< Gaussian bell with a standard deviation of 1/6 of the grain
+        };
+
+
+        /**
+         * Pool of grains that read from one source buffer and are summed into one output signal.
+         * All memory is allocated on construction. Each grain has a fractional read position, a speed, a gain and a window that is looked up in a precomputed table.
+         * The grains are processed in groups of eight using float8, the same way as the taps of the MultiTapReader.
+         * The source can either be a circular buffer with a power of two size, or a linear buffer outside of which the grains read silence.
+         */
+        class NAPAPI GrainPool
+        {
+        public:
+            static constexpr int laneCount = 8;             ///< Number of grains processed in parallel.
+            static constexpr int windowTableSize = 1024;    ///< Number of points in each window table.
+
+            /**
+             * Constructor
+             * @param maxGrainCount Maximum number of grains playing at the same time.
+             */
+            GrainPool(int maxGrainCount);
+
+            /**
+             * @return The maximum number of grains playing at the same time.
+             */
+            int getMaxGrainCount() const { return mMaxGrainCount; }
+
+            /**
+             * @return The number of grains currently playing.
+             */
+            int getGrainCount() const { return mGrainCount; }
+
+            /**
+             * Starts a new grain.
+             * @param position Read position in the source at the first sample of the grain.
+             * @param speed Playback speed in source samples per output sample. Negative speeds read backwards.
+             * @param gain Peak gain of the grain.
+             * @param duration Duration of the grain in output samples.
+             * @param delay Number of samples within the next processed block before the grain starts.
+             * @return False if the pool is full and the grain was not started.
+             */
+            bool start(double position, float speed, float gain, int duration, int delay);
+
+            /**
+             * Stops all grains immediately.
+             */
+            void clear();
+
+            /**
+             * Processes all grains for one block of output samples and removes the grains that have finished.
+             * @param source Pointer to the source buffer.
+             * @param sourceSize Size of the source buffer. Has to be a power of two if the source is circular.
+             * @param circular True if the source is a circular buffer, in which case read positions are wrapped.
+             * @param output Receives the sum of the grains.
+             * @param sampleCount Number of output samples.
+             * @param window Window shape applied to all grains.
+             */
+            void process(const SampleValue* source, int sourceSize, bool circular, SampleValue* output, int sampleCount, GrainWindow window);
+
+        private:
+            template <bool circular>
+            void process(const SampleValue* source, int sourceSize, SampleValue* output, int sampleCount, const float* window);
+
+            void removeFinishedGrains();
+
+            // Window tables with windowTableSize + 1 points each, the extra point simplifies interpolation at the end of the window.
+            static const std::vector<float>& getWindowTable(GrainWindow window);
+
+            int mMaxGrainCount = 0;
+            int mGrainCount = 0;
+            std::vector<double> mPositions;
+            std::vector<float> mSpeeds;
+            std::vector<float> mPhases;         // Position within the window from 0 to 1, negative while the grain is delayed
+            std::vector<float> mIncrements;     // Window phase increment per sample
+            std::vector<float> mGains;          // Sized to a multiple of laneCount, unused lanes have gain 0
+        };
+
+    }
+
+}
@@ -18,7 +18,7 @@ namespace nap
 
 	    /**
 	     * Karplus strong filter algorithm
-         * @tparam real Should be float, @float4 or @float8.
+         * @tparam real Should be float, @float4, @float8 or @float16. Vector types have a delay time and feedback per lane and have to be controlled from the audio thread.
 	     */
 		template <typename real>
 		class KarplusStrong
@@ -76,7 +76,7 @@ namespace nap
 			 */
 			void setDelayTime(real sampleTime, int stepCount)
 			{
-				assert(sampleTime <= mDelay->getMaxDelay());
+				assert(isBelow(sampleTime, mDelay->getMaxDelay() + 1));
 				mTime.setStepCount(stepCount);
 				mTime.setValue(sampleTime);
 			}
@@ -94,7 +94,7 @@ namespace nap
 			 */
 			void setFeedback(real feedback)
 			{
-				assert(feedback < 1.f);
+				assert(isBelow(feedback, 1.f));
 				mFeedback = feedback;
 			}
 
@@ -104,10 +104,23 @@ namespace nap
 			void flush() { mDelay->clear(); }
 
 		private:
+			// Returns true if all lanes of value are below limit
+			static bool isBelow(const real& value, float limit)
+			{
+				if constexpr (std::is_arithmetic<real>::value)
+					return value < limit;
+				else {
+					for (auto lane = 0; lane < int(sizeof(real) / sizeof(float)); ++lane)
+						if (!(value[lane] < limit))
+							return false;
+					return true;
+				}
+			}
+
 			OnePoleLowPass<real> mDampingFilter;
 			std::unique_ptr<VectorDelay<real>> mDelay = nullptr;
-			std::atomic<real> mFeedback = { 0.f };
-			FastLinearSmoothedValue<real> mTime = { 0.f, 44 };
+			OnePoleCoefficient<real> mFeedback = { real(0.f) };
+			FastLinearSmoothedValue<real> mTime = { real(0.f), 44 };
 		};
 
 	}
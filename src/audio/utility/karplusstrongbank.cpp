@@ -0,0 +1,263 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "karplusstrongbank.h"
+
+// Std includes
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// Nap includes
+#include <mathutils.h>
+
+// Audio includes
+#include <audio/utility/denormals.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+            float sumLanes(const float8& value)
+            {
+                return ((value[0] + value[1]) + (value[2] + value[3])) + ((value[4] + value[5]) + (value[6] + value[7]));
+            }
+        }
+
+
+        KarplusStrongBank::KarplusStrongBank(int maxStringCount, int maxDelay)
+        {
+            resize(maxStringCount, maxDelay);
+        }
+
+
+        void KarplusStrongBank::resize(int maxStringCount, int maxDelay)
+        {
+            assert(maxStringCount > 0);
+            mMaxStringCount = maxStringCount;
+            mStringCount = maxStringCount;
+            mDelaySize = 2;
+            while (mDelaySize < maxDelay + 2)
+                mDelaySize *= 2;
+
+            auto paddedCount = ((maxStringCount + laneCount - 1) / laneCount) * laneCount;
+            mDelay.assign(paddedCount * mDelaySize, 0.f);
+            mReadOffsets.assign(paddedCount, 0);
+            mFractions.assign(paddedCount, 0.f);
+            mFeedbacks.assign(paddedCount, 0.f);
+            mDampings.assign(paddedCount, 1.f);
+            mDampingStates.assign(paddedCount, 0.f);
+            mPolarities.assign(paddedCount, 1.f);
+            mInputGains.assign(paddedCount, 0.f);
+            mPluckGains.assign(paddedCount, 0.f);
+            mPluckDecays.assign(paddedCount, 0.f);
+            mPluckRemaining.assign(paddedCount / laneCount, 0);
+            mWriteIndex = 0;
+
+            for (auto string = 0; string < maxStringCount; ++string)
+                resetString(string);
+        }
+
+
+        void KarplusStrongBank::setStringCount(int stringCount)
+        {
+            stringCount = std::max(0, std::min(stringCount, mMaxStringCount));
+            for (auto string = stringCount; string < mStringCount; ++string)
+                muteString(string);
+            for (auto string = mStringCount; string < stringCount; ++string)
+                resetString(string);
+            mStringCount = stringCount;
+        }
+
+
+        void KarplusStrongBank::resetString(int string)
+        {
+            setDelayTime(string, 100.f);
+            setFeedback(string, 0.99f);
+            setDamping(string, 5000.f, 44100.f);
+            setNegativePolarity(string, false);
+            setInputGain(string, 1.f);
+            mDampingStates[string] = 0.f;
+            mPluckGains[string] = 0.f;
+
+            auto group = string / laneCount;
+            auto lane = string % laneCount;
+            auto delay = &mDelay[group * mDelaySize * laneCount];
+            for (auto i = 0; i < mDelaySize; ++i)
+                delay[i * laneCount + lane] = 0.f;
+        }
+
+
+        void KarplusStrongBank::muteString(int string)
+        {
+            mFeedbacks[string] = 0.f;
+            mInputGains[string] = 0.f;
+            mDampingStates[string] = 0.f;
+            mPluckGains[string] = 0.f;
+        }
+
+
+        void KarplusStrongBank::setDelayTime(int string, float sampleTime)
+        {
+            assert(string < mMaxStringCount);
+            sampleTime = std::max(1.f, std::min(sampleTime, float(getMaxDelay())));
+
+            // Reads the sample that was written sampleTime samples before the next write, relative to the write index
+            auto position = -1.f - sampleTime;
+            auto offset = int(std::floor(position));
+            mReadOffsets[string] = offset;
+            mFractions[string] = position - offset;
+        }
+
+
+        void KarplusStrongBank::setFeedback(int string, float feedback)
+        {
+            assert(string < mMaxStringCount);
+            assert(feedback < 1.f);
+            mFeedbacks[string] = feedback;
+        }
+
+
+        void KarplusStrongBank::setDamping(int string, float cutoffFrequency, float sampleRate)
+        {
+            assert(string < mMaxStringCount);
+            mDampings[string] = 1.f - std::exp(-math::PIX2 * cutoffFrequency / sampleRate);
+        }
+
+
+        void KarplusStrongBank::setNegativePolarity(int string, bool negative)
+        {
+            assert(string < mMaxStringCount);
+            mPolarities[string] = negative ? -1.f : 1.f;
+        }
+
+
+        void KarplusStrongBank::setInputGain(int string, float gain)
+        {
+            assert(string < mMaxStringCount);
+            mInputGains[string] = gain;
+        }
+
+
+        void KarplusStrongBank::pluck(int string, float amplitude)
+        {
+            assert(string < mMaxStringCount);
+            auto period = -mFractions[string] - mReadOffsets[string];
+            mPluckGains[string] = amplitude;
+            mPluckDecays[string] = std::pow(0.001f, 1.f / period);
+
+            // After two periods the burst has decayed 120dB
+            auto& remaining = mPluckRemaining[string / laneCount];
+            remaining = std::max(remaining, int(2.f * period) + 1);
+        }
+
+
+        void KarplusStrongBank::flush()
+        {
+            std::fill(mDelay.begin(), mDelay.end(), 0.f);
+            std::fill(mDampingStates.begin(), mDampingStates.end(), 0.f);
+            std::fill(mPluckGains.begin(), mPluckGains.end(), 0.f);
+            std::fill(mPluckRemaining.begin(), mPluckRemaining.end(), 0);
+        }
+
+
+        void KarplusStrongBank::process(const SampleValue* input, SampleValue* output, int sampleCount)
+        {
+            for (auto start = 0; start < sampleCount; start += blockSize)
+            {
+                auto count = std::min(blockSize, sampleCount - start);
+                processBlock((input != nullptr) ? input + start : nullptr, output + start, count);
+            }
+        }
+
+
+        void KarplusStrongBank::processBlock(const SampleValue* input, SampleValue* output, int sampleCount)
+        {
+            if (input != nullptr)
+                std::copy(input, input + sampleCount, mInputBuffer);
+            else
+                std::fill(mInputBuffer, mInputBuffer + sampleCount, 0.f);
+
+            for (auto i = 0; i < sampleCount; ++i)
+                mMix[i] = float8(0.f);
+
+            const int mask = mDelaySize - 1;
+            // Only the groups that contain active strings are processed
+            auto activeCount = ((mStringCount + laneCount - 1) / laneCount) * laneCount;
+            for (auto first = 0; first < activeCount; first += laneCount)
+            {
+                auto group = first / laneCount;
+                auto delay = &mDelay[group * mDelaySize * laneCount];
+
+                // The pluck bursts are only generated until they have decayed, the gains are cleared after the last block of a burst
+                bool plucking = mPluckRemaining[group] > 0;
+                if (plucking)
+                {
+                    mNoise.process(mNoiseBuffer, sampleCount * laneCount, NoiseColor::White);
+                    mPluckRemaining[group] -= sampleCount;
+                }
+
+                float8 fractions(&mFractions[first]);
+                float8 feedbacks(&mFeedbacks[first]);
+                float8 dampings(&mDampings[first]);
+                float8 polarities(&mPolarities[first]);
+                float8 inputGains(&mInputGains[first]);
+                float8 pluckDecays(&mPluckDecays[first]);
+                float8 pluckGains(&mPluckGains[first]);
+                float8 state(&mDampingStates[first]);
+                auto offsets = &mReadOffsets[first];
+
+                float x0[laneCount];
+                float x1[laneCount];
+                for (auto i = 0; i < sampleCount; ++i)
+                {
+                    auto writeIndex = mWriteIndex + i;
+                    for (auto lane = 0; lane < laneCount; ++lane)
+                    {
+                        auto index = (writeIndex + offsets[lane]) & mask;
+                        x0[lane] = delay[index * laneCount + lane];
+                        x1[lane] = delay[((index + 1) & mask) * laneCount + lane];
+                    }
+
+                    float8 a(x0);
+                    float8 b(x1);
+                    float8 value = (a + fractions * (b - a)) * feedbacks;
+                    state = flushDenormal(state + dampings * (value - state));
+
+                    float8 excitation = inputGains * mInputBuffer[i];
+                    if (plucking)
+                    {
+                        excitation = excitation + float8(&mNoiseBuffer[i * laneCount]) * pluckGains;
+                        pluckGains = pluckGains * pluckDecays;
+                    }
+
+                    float8 next = excitation + polarities * state;
+                    auto frame = &delay[(writeIndex & mask) * laneCount];
+                    for (auto lane = 0; lane < laneCount; ++lane)
+                        frame[lane] = next[lane];
+
+                    mMix[i] = mMix[i] + state;
+                }
+
+                for (auto lane = 0; lane < laneCount; ++lane)
+                {
+                    mDampingStates[first + lane] = state[lane];
+                    if (plucking)
+                        mPluckGains[first + lane] = (mPluckRemaining[group] > 0) ? pluckGains[lane] : 0.f;
+                }
+            }
+
+            mWriteIndex = (mWriteIndex + sampleCount) & mask;
+
+            for (auto i = 0; i < sampleCount; ++i)
+                output[i] = sumLanes(mMix[i]);
+        }
+
+    }
+
+}
@@ -0,0 +1,160 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+#include <audio/utility/noisegenerator.h>
+#include <audio/utility/vectorextension.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Bank of Karplus strong strings that are processed in groups of eight using float8, see KarplusStrong.
+         * Each string has its own delay time, feedback, damping, polarity and input gain, and can be plucked with a noise burst.
+         * All strings share one input signal and are summed into one output signal.
+         * All memory is allocated on construction and by resize() for a maximum number of strings, all other methods can be called on the audio thread.
+         */
+        class NAPAPI KarplusStrongBank
+        {
+        public:
+            static constexpr int laneCount = 8;     ///< Number of strings processed in parallel.
+            static constexpr int blockSize = 64;    ///< Number of samples processed at a time internally.
+
+            /**
+             * Constructor
+             * @param maxStringCount Maximum number of strings, all of them are active initially.
+             * @param maxDelay Maximum delay time in samples, determines the lowest frequency.
+             */
+            KarplusStrongBank(int maxStringCount = laneCount, int maxDelay = 2048);
+
+            /**
+             * Changes the maximum number of strings and the maximum delay time, activates all strings, resets them to their default settings and clears the delay lines.
+             * Allocates memory, so should not be called on the audio thread while the bank is processed.
+             * @param maxStringCount Maximum number of strings.
+             * @param maxDelay Maximum delay time in samples.
+             */
+            void resize(int maxStringCount, int maxDelay);
+
+            /**
+             * Changes the number of strings that are processed without allocating memory.
+             * Strings that become active are reset to their default settings and their delay lines are cleared.
+             * @param stringCount Number of active strings, clamped to the maximum number of strings.
+             */
+            void setStringCount(int stringCount);
+
+            /**
+             * @return The number of active strings.
+             */
+            int getStringCount() const { return mStringCount; }
+
+            /**
+             * @return The maximum number of strings.
+             */
+            int getMaxStringCount() const { return mMaxStringCount; }
+
+            /**
+             * @return The maximum delay time in samples.
+             */
+            int getMaxDelay() const { return mDelaySize - 2; }
+
+            /**
+             * Sets the delay time of a string, which determines its pitch.
+             * @param string Index of the string.
+             * @param sampleTime Delay time in samples, clamped between 1 and the maximum delay time.
+             */
+            void setDelayTime(int string, float sampleTime);
+
+            /**
+             * Sets the feedback multiplier of a string, which determines its decay time.
+             * @param string Index of the string.
+             * @param feedback Feedback multiplier, lower than 1.
+             */
+            void setFeedback(int string, float feedback);
+
+            /**
+             * Sets the cutoff frequency of the lowpass filter in the feedback loop of a string.
+             * @param string Index of the string.
+             * @param cutoffFrequency Cutoff frequency in Hz.
+             * @param sampleRate Sample rate the bank runs on.
+             */
+            void setDamping(int string, float cutoffFrequency, float sampleRate);
+
+            /**
+             * Sets the polarity of the feedback loop of a string. A negative polarity subtracts the feedback signal from the input, which creates only odd harmonics.
+             * @param string Index of the string.
+             * @param negative True for negative polarity.
+             */
+            void setNegativePolarity(int string, bool negative);
+
+            /**
+             * Sets the gain of the shared input signal for a string.
+             * @param string Index of the string.
+             * @param gain Gain multiplier, 0 to only excite the string by plucking.
+             */
+            void setInputGain(int string, float gain);
+
+            /**
+             * Excites a string with a burst of noise that decays 60dB over one period of the string.
+             * @param string Index of the string.
+             * @param amplitude Amplitude of the burst.
+             */
+            void pluck(int string, float amplitude);
+
+            /**
+             * Clears the delay lines and filter states of all strings.
+             */
+            void flush();
+
+            /**
+             * Processes all strings.
+             * @param input Input signal that is fed into all strings multiplied by their input gain, or nullptr for no input.
+             * @param output Receives the sum of all strings.
+             * @param sampleCount Number of samples.
+             */
+            void process(const SampleValue* input, SampleValue* output, int sampleCount);
+
+        private:
+            void processBlock(const SampleValue* input, SampleValue* output, int sampleCount);
+            void resetString(int string);   // Applies the default settings and clears the delay line
+            void muteString(int string);    // Silences a string that is no longer active, it stays part of a processed group
+
+            int mStringCount = 0;
+            int mMaxStringCount = 0;
+            int mDelaySize = 0;                 // Power of two
+            int mWriteIndex = 0;
+            std::vector<float> mDelay;          // Per group of eight strings mDelaySize frames of eight interleaved samples
+
+            // Per string, sized to a multiple of the maximum number of strings, unused lanes have feedback and gains 0
+            std::vector<int> mReadOffsets;      // Offset from the write index to the first of the two interpolated samples
+            std::vector<float> mFractions;      // Interpolation fraction between the two samples
+            std::vector<float> mFeedbacks;
+            std::vector<float> mDampings;       // Onepole lowpass coefficients
+            std::vector<float> mDampingStates;
+            std::vector<float> mPolarities;     // 1 or -1
+            std::vector<float> mInputGains;
+            std::vector<float> mPluckGains;
+            std::vector<float> mPluckDecays;    // Multiplier of the pluck gain per sample
+
+            std::vector<int> mPluckRemaining;   // Per group, samples until the pluck bursts of the group have decayed
+            NoiseGenerator mNoise;
+            float mNoiseBuffer[blockSize * laneCount];
+            float mInputBuffer[blockSize];
+            float8 mMix[blockSize];
+        };
+
+    }
+
+}
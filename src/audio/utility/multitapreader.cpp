@@ -0,0 +1,117 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "multitapreader.h"
+
+// Std includes
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// Nap includes
+#include <mathutils.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+            constexpr int sincLength = 2 * MultiTapReader::sincHalfLength;
+
+
+            std::vector<float> createSincTable()
+            {
+                std::vector<float> result((MultiTapReader::sincPhaseCount + 1) * sincLength);
+                for (auto phase = 0; phase <= MultiTapReader::sincPhaseCount; ++phase)
+                {
+                    double fraction = double(phase) / MultiTapReader::sincPhaseCount;
+                    double sum = 0.0;
+                    for (auto k = 0; k < sincLength; ++k)
+                    {
+                        // Distance of the sample at offset k - sincHalfLength + 1 to the read position
+                        double x = (k - MultiTapReader::sincHalfLength + 1) - fraction;
+                        double sinc = (x == 0.0) ? 1.0 : std::sin(math::PI * x) / (math::PI * x);
+                        double windowPosition = (x + MultiTapReader::sincHalfLength) / (2.0 * MultiTapReader::sincHalfLength);
+                        double window = 0.42 - 0.5 * std::cos(math::PIX2 * windowPosition) + 0.08 * std::cos(2.0 * math::PIX2 * windowPosition);
+                        result[phase * sincLength + k] = sinc * window;
+                        sum += sinc * window;
+                    }
+
+                    // Normalize to unity gain at DC
+                    for (auto k = 0; k < sincLength; ++k)
+                        result[phase * sincLength + k] /= sum;
+                }
+                return result;
+            }
+        }
+
+
+        MultiTapReader::MultiTapReader(int maxTapCount) : mMaxTapCount(maxTapCount)
+        {
+            assert(maxTapCount > 0);
+            auto paddedCount = ((maxTapCount + laneCount - 1) / laneCount) * laneCount;
+            mPositions.resize(paddedCount, 0.0);
+            mSpeeds.resize(paddedCount, 1.f);
+            mGains.resize(paddedCount, 0.f);
+
+            // Make sure the table is created before processing starts
+            getSincTable();
+        }
+
+
+        void MultiTapReader::setTapCount(int count)
+        {
+            mTapCount = std::max(0, std::min(count, mMaxTapCount));
+        }
+
+
+        void MultiTapReader::setPosition(int tap, double position, int sourceSize)
+        {
+            position = std::fmod(position, double(sourceSize));
+            if (position < 0.0)
+                position += sourceSize;
+            mPositions[tap] = position;
+        }
+
+
+        void MultiTapReader::process(const SampleValue* source, int sourceSize, SampleValue* output, int sampleCount, TapInterpolation interpolation)
+        {
+            assert(sourceSize > 0 && (sourceSize & (sourceSize - 1)) == 0);
+
+            TapReadContext context;
+            context.mSource = source;
+            context.mMask = sourceSize - 1;
+            context.mPositions = mPositions.data();
+            context.mSpeeds = mSpeeds.data();
+            context.mGains = mGains.data();
+            context.mTapCount = mTapCount;
+            context.mSincTable = getSincTable().data();
+
+            switch (interpolation)
+            {
+                case TapInterpolation::Linear:
+                    mKernels.readTapsLinear(context, output, sampleCount);
+                    break;
+                case TapInterpolation::Hermite:
+                    mKernels.readTapsHermite(context, output, sampleCount);
+                    break;
+                case TapInterpolation::Sinc:
+                    mKernels.readTapsSinc(context, output, sampleCount);
+                    break;
+            }
+        }
+
+
+        const std::vector<float>& MultiTapReader::getSincTable()
+        {
+            static const std::vector<float> table = createSincTable();
+            return table;
+        }
+
+    }
+
+}
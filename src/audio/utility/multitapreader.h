@@ -0,0 +1,115 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+#include <audio/utility/vectorkernels.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Interpolation used to read between the samples of a buffer at a fractional position.
+         */
+        enum class TapInterpolation
+        {
+            Linear,     ///< Linear interpolation between two samples
+            Hermite,    ///< Third order Hermite (Catmull-Rom) interpolation over four samples
+            Sinc        ///< Blackman windowed sinc interpolation over eight samples. Only band limited for speeds up to 1.
+        };
+
+
+        /**
+         * Reads a number of taps from a circular source buffer, each with its own fractional position, speed and gain, and sums them into one output signal.
+         * The taps are processed in groups of four, eight or sixteen by VectorKernels, depending on the instruction set selected at runtime, so the interpolation of a group costs about as much as the interpolation of a single tap.
+         * The source buffer size has to be a power of two.
+         * Taps read up to four samples ahead of their position for sinc interpolation and two for Hermite interpolation, so they have to stay that far behind the write position.
+         */
+        class NAPAPI MultiTapReader
+        {
+        public:
+            static constexpr int laneCount = 8;                                         ///< The tap arrays are padded to a multiple of this.
+            static constexpr int sincHalfLength = TapReadContext::sincHalfLength;       ///< Number of samples on each side of the position used by sinc interpolation.
+            static constexpr int sincPhaseCount = TapReadContext::sincPhaseCount;       ///< Resolution of the fractional position in the sinc table.
+
+            /**
+             * Constructor
+             * @param maxTapCount Maximum number of taps. All memory is allocated here.
+             */
+            MultiTapReader(int maxTapCount);
+
+            /**
+             * @return The maximum number of taps.
+             */
+            int getMaxTapCount() const { return mMaxTapCount; }
+
+            /**
+             * Sets the number of taps that are read. Taps beyond this number keep their state.
+             */
+            void setTapCount(int count);
+
+            /**
+             * @return The number of taps that are read.
+             */
+            int getTapCount() const { return mTapCount; }
+
+            /**
+             * Moves a tap to a position.
+             * @param tap Index of the tap.
+             * @param position Position in samples within the source buffer.
+             * @param sourceSize Size of the source buffer, used to wrap the position.
+             */
+            void setPosition(int tap, double position, int sourceSize);
+
+            /**
+             * @return The position of a tap in samples within the source buffer.
+             */
+            double getPosition(int tap) const { return mPositions[tap]; }
+
+            /**
+             * Sets the speed of a tap in samples per sample. Negative speeds read backwards.
+             */
+            void setSpeed(int tap, ControllerValue speed) { mSpeeds[tap] = speed; }
+
+            /**
+             * Sets the gain that a tap is mixed into the output with.
+             */
+            void setGain(int tap, ControllerValue gain) { mGains[tap] = gain; }
+
+            /**
+             * Reads all taps for a block of output samples and advances their positions.
+             * @param source Pointer to the circular source buffer.
+             * @param sourceSize Size of the source buffer. Has to be a power of two.
+             * @param output Receives the sum of the taps.
+             * @param sampleCount Number of output samples.
+             * @param interpolation Interpolation used to read the taps.
+             */
+            void process(const SampleValue* source, int sourceSize, SampleValue* output, int sampleCount, TapInterpolation interpolation);
+
+        private:
+            // Sinc coefficients for sincPhaseCount + 1 fractional positions, 2 * sincHalfLength per position.
+            static const std::vector<float>& getSincTable();
+
+            int mMaxTapCount = 0;
+            int mTapCount = 0;
+            std::vector<double> mPositions;     // Kept within the size of the source buffer to keep the precision of the fraction
+            std::vector<float> mSpeeds;
+            std::vector<float> mGains;          // Sized to a multiple of laneCount, padding lanes have gain 0
+            const VectorKernels& mKernels = getVectorKernels();
+        };
+
+    }
+
+}
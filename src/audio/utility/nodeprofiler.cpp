@@ -0,0 +1,221 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "nodeprofiler.h"
+
+// Std includes
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+            // Marks a slot that has been released. Lookups continue probing past it and it can be claimed again.
+            const Process* const releasedSlot = reinterpret_cast<const Process*>(std::uintptr_t(1));
+
+
+            // Hashes the address of a node to a slot index.
+            int getSlotIndex(const Process& node)
+            {
+                auto address = reinterpret_cast<std::uintptr_t>(&node);
+                return int(((address >> 4) * 2654435761u) % NodeProfiler::capacity);
+            }
+
+
+            void appendJSONString(std::ostringstream& stream, const std::string& value)
+            {
+                stream << '"';
+                for (auto character : value)
+                {
+                    if (character == '"' || character == '\\')
+                        stream << '\\';
+                    stream << character;
+                }
+                stream << '"';
+            }
+
+
+            void appendJSONMeasurement(std::ostringstream& stream, const NodeProfiler::Measurement& measurement)
+            {
+                stream << "{\"name\": ";
+                appendJSONString(stream, measurement.mName);
+                if (measurement.mNode != nullptr)
+                    stream << ", \"node\": \"" << static_cast<const void*>(measurement.mNode) << "\"";
+                stream << ", \"calls\": " << measurement.mCallCount;
+                stream << ", \"totalUs\": " << measurement.mTotalTime;
+                stream << ", \"averageUs\": " << measurement.getAverageTime();
+                stream << ", \"maxUs\": " << measurement.mMaxTime << "}";
+            }
+        }
+
+
+        NodeProfiler& NodeProfiler::get()
+        {
+            static NodeProfiler instance;
+            return instance;
+        }
+
+
+        NodeProfiler::NodeProfiler() : mSlots(new Slot[capacity]), mNames(capacity)
+        {
+        }
+
+
+        NodeProfiler::Slot* NodeProfiler::findSlot(const Process& node, bool claim)
+        {
+            auto index = getSlotIndex(node);
+            Slot* released = nullptr;
+            for (auto probe = 0; probe < capacity; ++probe)
+            {
+                auto& slot = mSlots[(index + probe) % capacity];
+                auto current = slot.mNode.load(std::memory_order_acquire);
+                if (current == &node)
+                    return &slot;
+                if (current == releasedSlot)
+                {
+                    if (released == nullptr)
+                        released = &slot;
+                }
+                else if (current == nullptr)
+                    break;
+            }
+
+            if (!claim)
+                return nullptr;
+
+            // The node has no slot: claim the first released slot of its probe sequence or the empty slot that ended it.
+            for (auto probe = 0; probe < capacity; ++probe)
+            {
+                auto& slot = mSlots[(index + probe) % capacity];
+                const Process* expected = slot.mNode.load(std::memory_order_acquire);
+                if (expected == &node)
+                    return &slot;
+                if (expected != nullptr && expected != releasedSlot)
+                    continue;
+                // Claim the slot, unless another thread claimed it first.
+                if (slot.mNode.compare_exchange_strong(expected, &node, std::memory_order_acq_rel) || expected == &node)
+                    return &slot;
+            }
+            return nullptr;
+        }
+
+
+        void NodeProfiler::registerNode(const Process& node, const std::string& name)
+        {
+            auto slot = findSlot(node, true);
+            if (slot != nullptr)
+                mNames[slot - mSlots.get()] = name;
+        }
+
+
+        void NodeProfiler::unregisterNode(const Process& node)
+        {
+            auto slot = findSlot(node, false);
+            if (slot == nullptr)
+                return;
+
+            slot->mCallCount.store(0, std::memory_order_relaxed);
+            slot->mTotalTime.store(0, std::memory_order_relaxed);
+            slot->mMaxTime.store(0, std::memory_order_relaxed);
+            mNames[slot - mSlots.get()].clear();
+            slot->mNode.store(releasedSlot, std::memory_order_release);
+        }
+
+
+        void NodeProfiler::record(const Process& node, std::uint64_t nanoseconds)
+        {
+            auto slot = findSlot(node, true);
+            if (slot == nullptr)
+                return;
+
+            slot->mCallCount.fetch_add(1, std::memory_order_relaxed);
+            slot->mTotalTime.fetch_add(nanoseconds, std::memory_order_relaxed);
+            auto max = slot->mMaxTime.load(std::memory_order_relaxed);
+            while (nanoseconds > max && !slot->mMaxTime.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed));
+        }
+
+
+        std::vector<NodeProfiler::Measurement> NodeProfiler::getNodeSnapshot() const
+        {
+            std::vector<Measurement> result;
+            for (auto i = 0; i < capacity; ++i)
+            {
+                auto& slot = mSlots[i];
+                auto node = slot.mNode.load(std::memory_order_acquire);
+                if (node == nullptr || node == releasedSlot)
+                    continue;
+
+                Measurement measurement;
+                measurement.mName = mNames[i];
+                measurement.mNode = node;
+                measurement.mCallCount = slot.mCallCount.load(std::memory_order_relaxed);
+                measurement.mTotalTime = slot.mTotalTime.load(std::memory_order_relaxed) / 1000.0;
+                measurement.mMaxTime = slot.mMaxTime.load(std::memory_order_relaxed) / 1000.0;
+                result.emplace_back(measurement);
+            }
+            return result;
+        }
+
+
+        std::vector<NodeProfiler::Measurement> NodeProfiler::getObjectSnapshot() const
+        {
+            std::map<std::string, Measurement> aggregated;
+            for (auto& measurement : getNodeSnapshot())
+            {
+                auto& entry = aggregated[measurement.mName];
+                entry.mName = measurement.mName;
+                entry.mCallCount += measurement.mCallCount;
+                entry.mTotalTime += measurement.mTotalTime;
+                entry.mMaxTime = std::max(entry.mMaxTime, measurement.mMaxTime);
+            }
+
+            std::vector<Measurement> result;
+            for (auto& pair : aggregated)
+                result.emplace_back(pair.second);
+            std::sort(result.begin(), result.end(), [](const Measurement& a, const Measurement& b) { return a.mTotalTime > b.mTotalTime; });
+            return result;
+        }
+
+
+        std::string NodeProfiler::toJSON() const
+        {
+            std::ostringstream stream;
+            stream << "{\n  \"objects\": [";
+            auto objects = getObjectSnapshot();
+            for (auto i = 0; i < objects.size(); ++i)
+            {
+                stream << (i == 0 ? "\n    " : ",\n    ");
+                appendJSONMeasurement(stream, objects[i]);
+            }
+            stream << "\n  ],\n  \"nodes\": [";
+            auto nodes = getNodeSnapshot();
+            for (auto i = 0; i < nodes.size(); ++i)
+            {
+                stream << (i == 0 ? "\n    " : ",\n    ");
+                appendJSONMeasurement(stream, nodes[i]);
+            }
+            stream << "\n  ]\n}\n";
+            return stream.str();
+        }
+
+
+        void NodeProfiler::reset()
+        {
+            for (auto i = 0; i < capacity; ++i)
+            {
+                mSlots[i].mCallCount.store(0, std::memory_order_relaxed);
+                mSlots[i].mTotalTime.store(0, std::memory_order_relaxed);
+                mSlots[i].mMaxTime.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    }
+
+}
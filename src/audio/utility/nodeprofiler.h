@@ -0,0 +1,172 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+// Audio includes
+#include <audio/utility/realtimechecker.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        // Forward declarations
+        class Process;
+
+
+        /**
+         * Collects the time spent in the process() method of individual nodes.
+         * Measurements are recorded on the audio thread without locking or allocating, into a fixed size table keyed by the address of the node.
+         * Nodes are registered with a name on the main thread, GraphInstance registers the nodes of its objects using the name of the AudioObjectInstance.
+         * Snapshots of the measurements can be taken on the main thread at any time.
+         * Instrumentation is only compiled in when NAP_AUDIO_PROFILING is defined, see NAP_AUDIO_NODE_SCOPE().
+         * Nodes release their slot in their destructor, see NAP_AUDIO_NODE_RELEASE().
+         */
+        class NAPAPI NodeProfiler
+        {
+        public:
+            /**
+             * Maximum number of nodes that can be measured. Nodes beyond this number are ignored.
+             */
+            static constexpr int capacity = 4096;
+
+            /**
+             * Snapshot of the measurements for one node or the aggregated measurements for an object name.
+             */
+            struct NAPAPI Measurement
+            {
+                std::string mName;                  ///< Name of the node's AudioObjectInstance, empty if the node has not been registered
+                const Process* mNode = nullptr;     ///< The measured node, nullptr for measurements aggregated by name
+                std::uint64_t mCallCount = 0;       ///< Number of measured process() calls
+                double mTotalTime = 0.0;            ///< Total time in microseconds
+                double mMaxTime = 0.0;              ///< Longest single process() call in microseconds
+
+                /**
+                 * @return The average duration of a process() call in microseconds.
+                 */
+                double getAverageTime() const { return mCallCount > 0 ? mTotalTime / mCallCount : 0.0; }
+            };
+
+            /**
+             * @return The profiler shared by all node managers in the process.
+             */
+            static NodeProfiler& get();
+
+            /**
+             * Assigns a name to a node. Called on the main thread.
+             * @param node The node.
+             * @param name The name the measurements of the node will be reported and aggregated under.
+             */
+            void registerNode(const Process& node, const std::string& name);
+
+            /**
+             * Removes the measurements and the name of a node and frees its slot. Called from the destructor of the node.
+             * @param node The node.
+             */
+            void unregisterNode(const Process& node);
+
+            /**
+             * Records the duration of a process() call. Called on the audio thread.
+             * @param node The node that has been processed.
+             * @param nanoseconds The duration of the call.
+             */
+            void record(const Process& node, std::uint64_t nanoseconds);
+
+            /**
+             * @return A snapshot of the measurements per node. Called on the main thread.
+             */
+            std::vector<Measurement> getNodeSnapshot() const;
+
+            /**
+             * @return A snapshot of the measurements aggregated per object name, sorted by total time. Called on the main thread.
+             */
+            std::vector<Measurement> getObjectSnapshot() const;
+
+            /**
+             * @return The measurements per object name and per node as a JSON string. Called on the main thread.
+             */
+            std::string toJSON() const;
+
+            /**
+             * Clears all the measurements, but keeps the registered names. Called on the main thread.
+             */
+            void reset();
+
+        private:
+            struct Slot
+            {
+                std::atomic<const Process*> mNode = { nullptr };
+                std::atomic<std::uint64_t> mCallCount = { 0 };
+                std::atomic<std::uint64_t> mTotalTime = { 0 };
+                std::atomic<std::uint64_t> mMaxTime = { 0 };
+            };
+
+            NodeProfiler();
+
+            // Finds the slot of the node. If claim is true and the node has no slot yet, a free slot is claimed. Returns nullptr if there is no slot.
+            Slot* findSlot(const Process& node, bool claim);
+
+            std::unique_ptr<Slot[]> mSlots;
+            std::vector<std::string> mNames; // Only accessed on the main thread
+        };
+
+
+        /**
+         * Measures the time between its construction and destruction and records it for a node.
+         */
+        class NodeProfileScope
+        {
+        public:
+            NodeProfileScope(const Process& node) : mNode(node), mStart(std::chrono::steady_clock::now()) { }
+
+            ~NodeProfileScope()
+            {
+                auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart);
+                NodeProfiler::get().record(mNode, duration.count());
+            }
+
+        private:
+            const Process& mNode;
+            std::chrono::steady_clock::time_point mStart;
+        };
+
+    }
+
+}
+
+
+/**
+ * Place in a node's process() method after the input pins have been pulled, to measure it with the NodeProfiler and to attribute real-time violations to it, see RealTimeChecker.
+ * Pulling processes the upstream nodes, so opening the scope before the pulls would include their time.
+ * Expands to an empty expression unless NAP_AUDIO_PROFILING or NAP_AUDIO_RTCHECK is defined.
+ * Nodes that use it call NAP_AUDIO_NODE_RELEASE() in their destructor to free their NodeProfiler slot.
+ */
+#ifdef NAP_AUDIO_PROFILING
+    #define NAP_AUDIO_PROFILE_SCOPE() nap::audio::NodeProfileScope napAudioNodeProfileScope(*this)
+    #define NAP_AUDIO_NODE_RELEASE() nap::audio::NodeProfiler::get().unregisterNode(*this)
+#else
+    #define NAP_AUDIO_PROFILE_SCOPE() static_cast<void>(0)
+    #define NAP_AUDIO_NODE_RELEASE() static_cast<void>(0)
+#endif
+
+#ifdef NAP_AUDIO_RTCHECK
+    #define NAP_AUDIO_RTCHECK_SCOPE() nap::audio::RealTimeChecker::Scope napAudioRealTimeScope(this)
+#else
+    #define NAP_AUDIO_RTCHECK_SCOPE() static_cast<void>(0)
+#endif
+
+#define NAP_AUDIO_NODE_SCOPE() NAP_AUDIO_PROFILE_SCOPE(); NAP_AUDIO_RTCHECK_SCOPE()
@@ -0,0 +1,113 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "noisegenerator.h"
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        NoiseGenerator::NoiseGenerator(uint32_t seed)
+        {
+            setSeed(seed);
+        }
+
+
+        void NoiseGenerator::setSeed(uint32_t seed)
+        {
+            // Derive the seed of each lane with splitmix32, xorshift needs a state that is not zero
+            int32_t lanes[laneCount];
+            for (auto lane = 0; lane < laneCount; ++lane)
+            {
+                uint32_t z = seed + (lane + 1) * 0x9e3779b9u;
+                z = (z ^ (z >> 16)) * 0x85ebca6bu;
+                z = (z ^ (z >> 13)) * 0xc2b2ae35u;
+                z ^= z >> 16;
+                lanes[lane] = (z != 0) ? z : 1;
+            }
+            mState = simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(lanes));
+
+            for (auto& state : mPinkState)
+                state = 0.f;
+            mBrownState = 0.f;
+        }
+
+
+        simde__m256 NoiseGenerator::next()
+        {
+            // Xorshift32 in every lane
+            auto x = mState;
+            x = simde_mm256_xor_si256(x, simde_mm256_slli_epi32(x, 13));
+            x = simde_mm256_xor_si256(x, simde_mm256_srli_epi32(x, 17));
+            x = simde_mm256_xor_si256(x, simde_mm256_slli_epi32(x, 5));
+            mState = x;
+
+            // The upper 24 bits fit exactly in a float, scale them to the range -1 to 1
+            auto value = simde_mm256_cvtepi32_ps(simde_mm256_srli_epi32(x, 8));
+            return simde_mm256_sub_ps(simde_mm256_mul_ps(value, simde_mm256_set1_ps(2.f / 16777216.f)), simde_mm256_set1_ps(1.f));
+        }
+
+
+        void NoiseGenerator::processWhite(SampleValue* output, int count)
+        {
+            auto i = 0;
+            for (; i + laneCount <= count; i += laneCount)
+                simde_mm256_storeu_ps(output + i, next());
+
+            if (i < count)
+            {
+                float remainder[laneCount];
+                simde_mm256_storeu_ps(remainder, next());
+                for (auto lane = 0; i < count; ++i, ++lane)
+                    output[i] = remainder[lane];
+            }
+        }
+
+
+        void NoiseGenerator::process(SampleValue* output, int count, NoiseColor color)
+        {
+            processWhite(output, count);
+
+            switch (color)
+            {
+                case NoiseColor::White:
+                    break;
+
+                case NoiseColor::Pink:
+                {
+                    // Paul Kellet's refined pink noise filter, accurate to within 0.05dB above 9.2Hz at 44.1kHz
+                    auto s = mPinkState;
+                    for (auto i = 0; i < count; ++i)
+                    {
+                        auto white = output[i];
+                        s[0] = 0.99886f * s[0] + white * 0.0555179f;
+                        s[1] = 0.99332f * s[1] + white * 0.0750759f;
+                        s[2] = 0.96900f * s[2] + white * 0.1538520f;
+                        s[3] = 0.86650f * s[3] + white * 0.3104856f;
+                        s[4] = 0.55000f * s[4] + white * 0.5329522f;
+                        s[5] = -0.7616f * s[5] - white * 0.0168980f;
+                        output[i] = (s[0] + s[1] + s[2] + s[3] + s[4] + s[5] + s[6] + white * 0.5362f) * 0.11f;
+                        s[6] = white * 0.115926f;
+                    }
+                    break;
+                }
+
+                case NoiseColor::Brown:
+                {
+                    // Leaky integrator, the leak removes the DC drift of a pure integrator
+                    for (auto i = 0; i < count; ++i)
+                    {
+                        mBrownState = (mBrownState + 0.02f * output[i]) / 1.02f;
+                        output[i] = mBrownState * 3.5f;
+                    }
+                    break;
+                }
+            }
+        }
+
+    }
+
+}
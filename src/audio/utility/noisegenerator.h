@@ -0,0 +1,75 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <cstdint>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+#include <audio/utility/simde/x86/avx2.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Spectrum of the noise produced by a NoiseGenerator.
+         */
+        enum class NoiseColor
+        {
+            White,  ///< Equal energy per frequency
+            Pink,   ///< Energy falls 3dB per octave, equal energy per octave
+            Brown   ///< Energy falls 6dB per octave
+        };
+
+
+        /**
+         * Noise generator that produces bipolar noise between -1 and 1.
+         * White noise is generated eight samples at a time by eight xorshift generators in the lanes of one 256 bit vector.
+         * Pink and brown noise are filtered from the white noise. Each generator has its own state, so generators on different threads do not interfere and the output is reproducible for a given seed.
+         */
+        class NAPAPI NoiseGenerator
+        {
+        public:
+            static constexpr int laneCount = 8; ///< Number of samples generated in parallel.
+
+            /**
+             * Constructor
+             * @param seed Seed of the generator, generators with the same seed produce the same noise.
+             */
+            NoiseGenerator(uint32_t seed = 1);
+
+            /**
+             * Restarts the generator from a seed and clears the state of the pink and brown filters.
+             * @param seed Seed of the generator.
+             */
+            void setSeed(uint32_t seed);
+
+            /**
+             * Fills a buffer with noise.
+             * @param output Buffer to write to.
+             * @param count Number of samples to write.
+             * @param color Spectrum of the noise.
+             */
+            void process(SampleValue* output, int count, NoiseColor color);
+
+        private:
+            void processWhite(SampleValue* output, int count);
+            simde__m256 next(); // Returns the next eight white noise samples
+
+            simde__m256i mState;
+            SampleValue mPinkState[7] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+            SampleValue mBrownState = 0.f;
+        };
+
+    }
+
+}
@@ -7,8 +7,10 @@
 #include <audio/utility/audiotypes.h>
 #include <mathutils.h>
 #include <audio/utility/vectorextension.h>
+#include <audio/utility/denormals.h>
 
 #include <atomic>
+#include <type_traits>
 
 namespace nap
 {
@@ -16,6 +18,15 @@ namespace nap
 	namespace audio
 	{
 
+		/**
+		 * Type of the coefficients of the filters below.
+		 * For float the coefficients are atomic so they can be set from the control thread.
+		 * Atomics of float4 and float8 are not lock free, so for vector types the coefficients are plain values that have to be set on the audio thread.
+		 */
+		template <typename real>
+		using OnePoleCoefficient = std::conditional_t<std::is_arithmetic<real>::value, std::atomic<real>, real>;
+
+
 	    /**
 	     * One pole lowpass filter algorithm
 	     * @tparam real Can be float, float4 or float8 to enable SIMD processing
@@ -33,8 +44,7 @@ namespace nap
 			 */
 			real process(const real& input)
 			{
-				auto value = output + cf * (input - output);
-				output = value;
+				output = flushDenormal(output + cf * (input - output));
 				return output;
 			}
 
@@ -46,12 +56,12 @@ namespace nap
 			void setCutoffFrequency(float cutoffFrequency, float sampleRate)
 			{
 				real c = real(cutoffFrequency / sampleRate);
-				cf = 1 - powVec(real(math::E), real(-math::PIX2) * c);
+				cf = real(1.f) - powVec(real(math::E), real(-math::PIX2) * c);
 			}
 
 		private:
-			std::atomic<real> cf = { 0.f };
-			real output = { 0.f };
+			OnePoleCoefficient<real> cf = { real(0.f) };
+			real output = real(0.f);
 		};
 
 
@@ -72,7 +82,7 @@ namespace nap
              */
 			real process(const real& input)
 			{
-				output = a0 * input + a1 * previousInput + b1 * output;
+				output = flushDenormal(a0 * input + a1 * previousInput + b1 * output);
 				previousInput = input;
 				return output;
 			}
@@ -84,21 +94,21 @@ namespace nap
 			 */
 			void setCutoffFrequency(ControllerValue cutoffFrequency, float sampleRate)
 			{
-				real c = cutoffFrequency / sampleRate;
+				real c = real(cutoffFrequency / sampleRate);
 				real x = powVec(real(math::E), real(-math::M2_PI) * c);
 				real one = real(1.f);
 				real two = real(2.f);
 				a0 = (one + x) / two;
-				a1 = -(one + x) / two;
+				a1 = (real(0.f) - (one + x)) / two;
 				b1 = x;
 			}
 
 		private:
-			std::atomic<real> a0 = { 1.0 };
-			std::atomic<real> a1 = { 0.f };
-			std::atomic<real> b1 = { 0.f };
-			real output = { 0.f };
-			real previousInput = { 0.f };
+			OnePoleCoefficient<real> a0 = { real(1.f) };
+			OnePoleCoefficient<real> a1 = { real(0.f) };
+			OnePoleCoefficient<real> b1 = { real(0.f) };
+			real output = real(0.f);
+			real previousInput = real(0.f);
 		};
 
 	}
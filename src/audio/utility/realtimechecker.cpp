@@ -0,0 +1,219 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "realtimechecker.h"
+
+// Std includes
+#include <cstdlib>
+#include <typeinfo>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #include <execinfo.h>
+    #define NAP_AUDIO_RTCHECK_BACKTRACE
+#endif
+
+#ifdef __GNUC__
+    #include <cxxabi.h>
+#endif
+
+// Nap includes
+#include <nap/logger.h>
+
+// Audio includes
+#include <audio/core/process.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+            // State of the calling thread. Has a trivial type so accessing it never allocates through operator new.
+            struct ThreadState
+            {
+                const Process* mNode = nullptr;
+                int mDepth = 0;
+                bool mRecording = false; // Guards against recursion when recording a violation allocates itself
+            };
+
+            thread_local ThreadState threadState;
+
+
+            std::string demangle(const char* name)
+            {
+#ifdef __GNUC__
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+                if (status == 0 && demangled != nullptr)
+                {
+                    std::string result = demangled;
+                    std::free(demangled);
+                    return result;
+                }
+#endif
+                return name;
+            }
+        }
+
+
+        RealTimeChecker::Scope::Scope(const Process* node)
+        {
+#ifdef NAP_AUDIO_RTCHECK
+            // Make sure the checker is constructed outside of the scope, its construction allocates.
+            RealTimeChecker::get();
+            mPreviousNode = threadState.mNode;
+            threadState.mNode = node;
+            threadState.mDepth++;
+#endif
+        }
+
+
+        RealTimeChecker::Scope::~Scope()
+        {
+#ifdef NAP_AUDIO_RTCHECK
+            threadState.mDepth--;
+            threadState.mNode = mPreviousNode;
+#endif
+        }
+
+
+        RealTimeChecker& RealTimeChecker::get()
+        {
+            static RealTimeChecker instance;
+            return instance;
+        }
+
+
+        RealTimeChecker::RealTimeChecker() : mSlots(new Slot[capacity])
+        {
+#ifdef NAP_AUDIO_RTCHECK_BACKTRACE
+            // The first call to backtrace() can allocate while loading the unwinder, do it here instead of on the audio thread.
+            void* frames[1];
+            backtrace(frames, 1);
+#endif
+        }
+
+
+        bool RealTimeChecker::isInScope()
+        {
+#ifdef NAP_AUDIO_RTCHECK
+            return threadState.mDepth > 0 && !threadState.mRecording;
+#else
+            return false;
+#endif
+        }
+
+
+        void RealTimeChecker::check(ViolationType type)
+        {
+            if (!isInScope())
+                return;
+
+            threadState.mRecording = true;
+            mViolationCount++;
+            auto node = threadState.mNode;
+
+            // Only count duplicates of a violation that has not been read yet
+            bool duplicate = false;
+            for (auto i = 0; i < capacity && !duplicate; ++i)
+            {
+                auto& slot = mSlots[i];
+                if (slot.mReady.load(std::memory_order_acquire) && slot.mType == type && slot.mNode == node)
+                    duplicate = true;
+            }
+
+            if (!duplicate)
+            {
+                for (auto i = 0; i < capacity; ++i)
+                {
+                    auto& slot = mSlots[i];
+                    bool expected = false;
+                    if (!slot.mUsed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                        continue;
+
+                    slot.mType = type;
+                    slot.mNode = node;
+                    slot.mNodeType = (node != nullptr) ? typeid(*node).name() : nullptr;
+#ifdef NAP_AUDIO_RTCHECK_BACKTRACE
+                    slot.mFrameCount = backtrace(slot.mFrames, maxFrameCount);
+#else
+                    slot.mFrameCount = 0;
+#endif
+                    slot.mReady.store(true, std::memory_order_release);
+                    break;
+                }
+            }
+
+            threadState.mRecording = false;
+        }
+
+
+        std::vector<RealTimeChecker::Violation> RealTimeChecker::takeViolations()
+        {
+            std::vector<Violation> result;
+            for (auto i = 0; i < capacity; ++i)
+            {
+                auto& slot = mSlots[i];
+                if (!slot.mReady.load(std::memory_order_acquire))
+                    continue;
+
+                Violation violation;
+                violation.mType = slot.mType;
+                violation.mNode = slot.mNode;
+                if (slot.mNodeType != nullptr)
+                    violation.mNodeType = demangle(slot.mNodeType);
+
+#ifdef NAP_AUDIO_RTCHECK_BACKTRACE
+                char** symbols = backtrace_symbols(slot.mFrames, slot.mFrameCount);
+                if (symbols != nullptr)
+                {
+                    for (auto frame = 0; frame < slot.mFrameCount; ++frame)
+                        violation.mBacktrace.emplace_back(symbols[frame]);
+                    std::free(symbols);
+                }
+#endif
+                result.emplace_back(std::move(violation));
+
+                slot.mReady.store(false, std::memory_order_release);
+                slot.mUsed.store(false, std::memory_order_release);
+            }
+            return result;
+        }
+
+
+        int RealTimeChecker::logViolations()
+        {
+            auto count = mViolationCount.exchange(0);
+            for (auto& violation : takeViolations())
+            {
+                std::string node = violation.mNode != nullptr ? violation.mNodeType : "NodeManager";
+                std::string backtrace;
+                for (auto& frame : violation.mBacktrace)
+                    backtrace += "\n    " + frame;
+                Logger::warn("Real-time violation: %s on the audio thread in %s (%p)%s", toString(violation.mType), node.c_str(), static_cast<const void*>(violation.mNode), backtrace.c_str());
+            }
+            return count;
+        }
+
+
+        const char* RealTimeChecker::toString(ViolationType type)
+        {
+            switch (type)
+            {
+                case ViolationType::Allocation:
+                    return "allocation";
+                case ViolationType::Deallocation:
+                    return "deallocation";
+                case ViolationType::Lock:
+                    return "lock";
+            }
+            return "";
+        }
+
+    }
+
+}
+
@@ -0,0 +1,212 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        // Forward declarations
+        class Process;
+
+
+        /**
+         * Debug instrumentation that detects operations that are not real-time safe on the audio thread.
+         * When NAP_AUDIO_RTCHECK is defined every allocation or deallocation that happens within a RealTimeChecker::Scope is reported, when it passes through one of two opt-in hooks:
+         * - RealTimeCheckedAllocator, an allocator for containers that are used on the audio thread.
+         * - NAP_AUDIO_RTCHECK_ALLOCATION_HOOKS(), which an application expands in one source file of its executable to replace the global operator new and delete, see realtimecheckerhooks.h.
+         * The module itself never replaces the global allocation functions, as a replacement within a dynamically loaded module is unreliable.
+         * Locks are reported when they are taken through a RealTimeMutex.
+         * Scopes are opened by NAP_AUDIO_NODE_SCOPE() in the process() method of the nodes, so violations are attributed to the node that is being processed.
+         * Hosts that drive a NodeManager can open a scope without node around NodeManager::process() to also catch violations outside of the nodes, for example in enqueued tasks.
+         * Violations are stored on the audio thread in a fixed size table without locking or allocating, together with a backtrace where the platform supports it.
+         * They are reported on the main thread using logViolations().
+         * Without NAP_AUDIO_RTCHECK nothing is recorded and all methods are cheap no-ops.
+         */
+        class NAPAPI RealTimeChecker
+        {
+        public:
+            /**
+             * Maximum number of violations that are stored until they are read. Duplicates of a stored violation are only counted.
+             */
+            static constexpr int capacity = 64;
+
+            /**
+             * Maximum number of backtrace frames stored per violation.
+             */
+            static constexpr int maxFrameCount = 32;
+
+            enum class ViolationType { Allocation, Deallocation, Lock };
+
+            /**
+             * A violation read on the main thread.
+             */
+            struct NAPAPI Violation
+            {
+                ViolationType mType = ViolationType::Allocation;
+                const Process* mNode = nullptr;         ///< The node that was being processed, nullptr if the violation happened outside of a node.
+                std::string mNodeType;                  ///< Type name of the node, empty if the violation happened outside of a node.
+                std::vector<std::string> mBacktrace;    ///< Symbolized backtrace, empty on platforms without backtrace support.
+            };
+
+            /**
+             * Marks the current thread as processing audio until it is destructed. Scopes can be nested.
+             */
+            class NAPAPI Scope
+            {
+            public:
+                /**
+                 * @param node The node that is being processed, or nullptr for processing outside of a node.
+                 */
+                Scope(const Process* node);
+                ~Scope();
+
+            private:
+                const Process* mPreviousNode = nullptr;
+            };
+
+            /**
+             * @return The checker shared by all node managers in the process.
+             */
+            static RealTimeChecker& get();
+
+            /**
+             * @return True if the checker is compiled in with NAP_AUDIO_RTCHECK.
+             */
+            static constexpr bool isEnabled()
+            {
+#ifdef NAP_AUDIO_RTCHECK
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            /**
+             * @return True if the calling thread is within a Scope.
+             */
+            static bool isInScope();
+
+            /**
+             * Records a violation if the calling thread is within a Scope. Called on the audio thread.
+             * @param type The type of the violation.
+             */
+            void check(ViolationType type);
+
+            /**
+             * Reads and clears the stored violations. Called on the main thread.
+             * @return The violations that were stored since the last call.
+             */
+            std::vector<Violation> takeViolations();
+
+            /**
+             * Reads and clears the stored violations and logs each of them as a warning. Called on the main thread.
+             * @return The number of violations that occurred since the last call, including duplicates and violations that did not fit in the table.
+             */
+            int logViolations();
+
+            /**
+             * @return Readable name of a violation type.
+             */
+            static const char* toString(ViolationType type);
+
+        private:
+            struct Slot
+            {
+                std::atomic<bool> mUsed = { false };        // Claimed by the audio thread
+                std::atomic<bool> mReady = { false };       // Written and ready to be read by the main thread
+                ViolationType mType = ViolationType::Allocation;
+                const Process* mNode = nullptr;
+                const char* mNodeType = nullptr;
+                void* mFrames[maxFrameCount];
+                int mFrameCount = 0;
+            };
+
+            RealTimeChecker();
+
+            std::unique_ptr<Slot[]> mSlots;
+            std::atomic<int> mViolationCount = { 0 };
+        };
+
+
+        /**
+         * Allocator that reports its allocations and deallocations to the RealTimeChecker when NAP_AUDIO_RTCHECK is defined.
+         * Use it for containers that are used on the audio thread and should not allocate after initialization, for example std::vector<float, RealTimeCheckedAllocator<float>>.
+         * Without NAP_AUDIO_RTCHECK it behaves as std::allocator.
+         */
+        template <typename T>
+        class RealTimeCheckedAllocator
+        {
+        public:
+            using value_type = T;
+
+            RealTimeCheckedAllocator() = default;
+
+            template <typename U>
+            RealTimeCheckedAllocator(const RealTimeCheckedAllocator<U>&) noexcept { }
+
+            T* allocate(std::size_t count)
+            {
+#ifdef NAP_AUDIO_RTCHECK
+                RealTimeChecker::get().check(RealTimeChecker::ViolationType::Allocation);
+#endif
+                return std::allocator<T>().allocate(count);
+            }
+
+            void deallocate(T* pointer, std::size_t count)
+            {
+#ifdef NAP_AUDIO_RTCHECK
+                RealTimeChecker::get().check(RealTimeChecker::ViolationType::Deallocation);
+#endif
+                std::allocator<T>().deallocate(pointer, count);
+            }
+
+            template <typename U>
+            bool operator==(const RealTimeCheckedAllocator<U>&) const noexcept { return true; }
+
+            template <typename U>
+            bool operator!=(const RealTimeCheckedAllocator<U>&) const noexcept { return false; }
+        };
+
+
+        /**
+         * Mutex that reports a violation to the RealTimeChecker when it is locked within a RealTimeChecker::Scope.
+         * Use it instead of std::mutex for locks that can be taken by a node, so the checker can tell when the audio thread blocks.
+         */
+        class NAPAPI RealTimeMutex
+        {
+        public:
+            void lock()
+            {
+#ifdef NAP_AUDIO_RTCHECK
+                RealTimeChecker::get().check(RealTimeChecker::ViolationType::Lock);
+#endif
+                mMutex.lock();
+            }
+
+            bool try_lock() { return mMutex.try_lock(); }
+
+            void unlock() { mMutex.unlock(); }
+
+        private:
+            std::mutex mMutex;
+        };
+
+    }
+
+}
@@ -0,0 +1,104 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <cstdlib>
+#include <new>
+
+// Audio includes
+#include <audio/utility/realtimechecker.h>
+
+/**
+ * Replaces the global operator new and delete, including the aligned overloads, with versions that report calls within a RealTimeChecker::Scope.
+ * This is opt-in: expand the macro once at global scope in a source file of the executable, for example next to main(), and build with the NAP_AUDIO_RTCHECK cmake option.
+ * Replacing the allocation functions is only reliable in the executable. On Windows it only covers the allocations of the module it is expanded in, unless all modules share the dynamic C runtime.
+ * Expands to nothing unless NAP_AUDIO_RTCHECK is defined.
+ */
+#ifdef NAP_AUDIO_RTCHECK
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace rtcheckhooks
+        {
+
+            inline void* allocate(std::size_t size)
+            {
+                if (RealTimeChecker::isInScope())
+                    RealTimeChecker::get().check(RealTimeChecker::ViolationType::Allocation);
+                return std::malloc(size == 0 ? 1 : size);
+            }
+
+
+            inline void* allocateAligned(std::size_t size, std::align_val_t alignment)
+            {
+                if (RealTimeChecker::isInScope())
+                    RealTimeChecker::get().check(RealTimeChecker::ViolationType::Allocation);
+                auto align = static_cast<std::size_t>(alignment);
+                size = (size == 0) ? align : (size + align - 1) / align * align;
+#ifdef _MSC_VER
+                return _aligned_malloc(size, align);
+#else
+                return std::aligned_alloc(align, size);
+#endif
+            }
+
+
+            inline void free(void* pointer)
+            {
+                if (pointer != nullptr && RealTimeChecker::isInScope())
+                    RealTimeChecker::get().check(RealTimeChecker::ViolationType::Deallocation);
+                std::free(pointer);
+            }
+
+
+            inline void freeAligned(void* pointer)
+            {
+                if (pointer != nullptr && RealTimeChecker::isInScope())
+                    RealTimeChecker::get().check(RealTimeChecker::ViolationType::Deallocation);
+#ifdef _MSC_VER
+                _aligned_free(pointer);
+#else
+                std::free(pointer);
+#endif
+            }
+
+        }
+
+    }
+
+}
+
+#define NAP_AUDIO_RTCHECK_ALLOCATION_HOOKS() \
+    void* operator new(std::size_t size) { if (auto result = nap::audio::rtcheckhooks::allocate(size)) return result; throw std::bad_alloc(); } \
+    void* operator new[](std::size_t size) { if (auto result = nap::audio::rtcheckhooks::allocate(size)) return result; throw std::bad_alloc(); } \
+    void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return nap::audio::rtcheckhooks::allocate(size); } \
+    void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return nap::audio::rtcheckhooks::allocate(size); } \
+    void* operator new(std::size_t size, std::align_val_t alignment) { if (auto result = nap::audio::rtcheckhooks::allocateAligned(size, alignment)) return result; throw std::bad_alloc(); } \
+    void* operator new[](std::size_t size, std::align_val_t alignment) { if (auto result = nap::audio::rtcheckhooks::allocateAligned(size, alignment)) return result; throw std::bad_alloc(); } \
+    void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return nap::audio::rtcheckhooks::allocateAligned(size, alignment); } \
+    void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return nap::audio::rtcheckhooks::allocateAligned(size, alignment); } \
+    void operator delete(void* pointer) noexcept { nap::audio::rtcheckhooks::free(pointer); } \
+    void operator delete[](void* pointer) noexcept { nap::audio::rtcheckhooks::free(pointer); } \
+    void operator delete(void* pointer, std::size_t) noexcept { nap::audio::rtcheckhooks::free(pointer); } \
+    void operator delete[](void* pointer, std::size_t) noexcept { nap::audio::rtcheckhooks::free(pointer); } \
+    void operator delete(void* pointer, const std::nothrow_t&) noexcept { nap::audio::rtcheckhooks::free(pointer); } \
+    void operator delete[](void* pointer, const std::nothrow_t&) noexcept { nap::audio::rtcheckhooks::free(pointer); } \
+    void operator delete(void* pointer, std::align_val_t) noexcept { nap::audio::rtcheckhooks::freeAligned(pointer); } \
+    void operator delete[](void* pointer, std::align_val_t) noexcept { nap::audio::rtcheckhooks::freeAligned(pointer); } \
+    void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { nap::audio::rtcheckhooks::freeAligned(pointer); } \
+    void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { nap::audio::rtcheckhooks::freeAligned(pointer); } \
+    void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { nap::audio::rtcheckhooks::freeAligned(pointer); } \
+    void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { nap::audio::rtcheckhooks::freeAligned(pointer); }
+
+#else
+
+#define NAP_AUDIO_RTCHECK_ALLOCATION_HOOKS()
+
+#endif
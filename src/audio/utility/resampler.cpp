@@ -0,0 +1,151 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "resampler.h"
+
+// Std includes
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+// Nap includes
+#include <mathutils.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+            // Zeroth order modified Bessel function of the first kind, used by the Kaiser window.
+            double besselI0(double x)
+            {
+                double sum = 1.0;
+                double term = 1.0;
+                for (auto k = 1; k < 32; ++k)
+                {
+                    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                    sum += term;
+                }
+                return sum;
+            }
+
+            // Kaiser window shape parameter, giving roughly 80dB of stopband attenuation.
+            constexpr double kaiserBeta = 8.0;
+
+            // Cutoff as a fraction of the Nyquist frequency of the lower sample rate. Leaves room for the transition band.
+            constexpr double relativeCutoff = 0.9;
+        }
+
+
+        Resampler::Resampler(int factor, int tapsPerPhase) : mFactor(factor), mTapsPerPhase(tapsPerPhase)
+        {
+            assert(factor >= 1);
+            assert(tapsPerPhase >= 1);
+        }
+
+
+        void Resampler::reset()
+        {
+            std::fill(mHistory.begin(), mHistory.end(), 0.f);
+            mIndex = 0;
+        }
+
+
+        std::vector<float> Resampler::createLowPass(int factor, int length)
+        {
+            std::vector<float> result(length);
+            auto cutoff = relativeCutoff * 0.5 / factor; // In cycles per sample at the higher sample rate
+            auto center = (length - 1) * 0.5;
+            auto normalization = besselI0(kaiserBeta);
+            auto sum = 0.0;
+            for (auto i = 0; i < length; ++i)
+            {
+                auto x = i - center;
+                auto sinc = (x == 0.0) ? 2.0 * cutoff : std::sin(math::PIX2 * cutoff * x) / (math::PI * x);
+                auto ratio = (length > 1) ? (2.0 * i / (length - 1) - 1.0) : 0.0;
+                auto window = besselI0(kaiserBeta * std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) / normalization;
+                result[i] = sinc * window;
+                sum += result[i];
+            }
+
+            // Normalize to unity gain at DC
+            for (auto& coefficient : result)
+                coefficient /= sum;
+
+            return result;
+        }
+
+
+        UpSampler::UpSampler(int factor, int tapsPerPhase) : Resampler(factor, tapsPerPhase)
+        {
+            auto lowPass = createLowPass(factor, factor * tapsPerPhase);
+
+            // Rearrange the coefficients per phase and compensate for the energy lost by zero stuffing.
+            mCoefficients.resize(lowPass.size());
+            for (auto phase = 0; phase < factor; ++phase)
+                for (auto tap = 0; tap < tapsPerPhase; ++tap)
+                    mCoefficients[phase * tapsPerPhase + tap] = lowPass[phase + tap * factor] * factor;
+
+            mHistory.resize(2 * tapsPerPhase, 0.f);
+        }
+
+
+        void UpSampler::process(const SampleValue* input, int inputSampleCount, SampleValue* output)
+        {
+            for (auto i = 0; i < inputSampleCount; ++i)
+            {
+                // Write the new sample twice so the window of the last mTapsPerPhase samples is contiguous, newest first.
+                mIndex = (mIndex == 0) ? mTapsPerPhase - 1 : mIndex - 1;
+                mHistory[mIndex] = input[i];
+                mHistory[mIndex + mTapsPerPhase] = input[i];
+                const float* window = &mHistory[mIndex];
+
+                for (auto phase = 0; phase < mFactor; ++phase)
+                {
+                    const float* coefficients = &mCoefficients[phase * mTapsPerPhase];
+                    float sum = 0.f;
+                    for (auto tap = 0; tap < mTapsPerPhase; ++tap)
+                        sum += coefficients[tap] * window[tap];
+                    *output++ = sum;
+                }
+            }
+        }
+
+
+        DownSampler::DownSampler(int factor, int tapsPerPhase) : Resampler(factor, tapsPerPhase)
+        {
+            mCoefficients = createLowPass(factor, factor * tapsPerPhase);
+            mHistory.resize(2 * mCoefficients.size(), 0.f);
+        }
+
+
+        void DownSampler::process(const SampleValue* input, int inputSampleCount, SampleValue* output)
+        {
+            assert(inputSampleCount % mFactor == 0);
+            int length = mCoefficients.size();
+
+            for (auto i = 0; i < inputSampleCount; ++i)
+            {
+                mIndex = (mIndex == 0) ? length - 1 : mIndex - 1;
+                mHistory[mIndex] = input[i];
+                mHistory[mIndex + length] = input[i];
+
+                // Only calculate the filter output for the first sample of every group, which is the one that is kept.
+                if (i % mFactor == 0)
+                {
+                    const float* window = &mHistory[mIndex];
+                    float sum = 0.f;
+                    for (auto tap = 0; tap < length; ++tap)
+                        sum += mCoefficients[tap] * window[tap];
+                    *output++ = sum;
+                }
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,97 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Std includes
+#include <vector>
+
+// Nap includes
+#include <utility/dllexport.h>
+
+// Audio includes
+#include <audio/utility/audiotypes.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * Base class for polyphase FIR resamplers that convert a signal by a whole number factor.
+         * The anti-aliasing/anti-imaging lowpass filter is a Kaiser windowed sinc that is designed on construction.
+         * Processing does not allocate and can be performed on the audio thread.
+         */
+        class NAPAPI Resampler
+        {
+        public:
+            /**
+             * Constructor
+             * @param factor The resampling factor
+             * @param tapsPerPhase Number of filter taps per polyphase branch. The total filter length is factor * tapsPerPhase.
+             */
+            Resampler(int factor, int tapsPerPhase);
+            virtual ~Resampler() = default;
+
+            /**
+             * Resamples a block of samples.
+             * @param input Pointer to the input samples.
+             * @param inputSampleCount Number of samples to be read from the input. For a DownSampler this has to be a multiple of the factor.
+             * @param output Pointer to the output samples. Has to point to inputSampleCount * factor samples for an UpSampler and inputSampleCount / factor samples for a DownSampler.
+             */
+            virtual void process(const SampleValue* input, int inputSampleCount, SampleValue* output) = 0;
+
+            /**
+             * Clears the filter history.
+             */
+            void reset();
+
+            /**
+             * @return The resampling factor.
+             */
+            int getFactor() const { return mFactor; }
+
+            /**
+             * @return The group delay of the filter, in samples at the higher of both sample rates.
+             */
+            float getDelay() const { return (mCoefficients.size() - 1) * 0.5f; }
+
+        protected:
+            // Designs the lowpass filter with a cutoff just below the Nyquist frequency of the lower sample rate.
+            static std::vector<float> createLowPass(int factor, int length);
+
+            int mFactor = 1;
+            int mTapsPerPhase = 0;
+            std::vector<float> mCoefficients; // Lowpass filter coefficients, layout depends on the derived class
+            std::vector<float> mHistory; // Delay line, written twice so a contiguous window of history is always available
+            int mIndex = 0;
+        };
+
+
+        /**
+         * Raises the sample rate of a signal by a whole number factor by zero stuffing and polyphase lowpass filtering.
+         */
+        class NAPAPI UpSampler : public Resampler
+        {
+        public:
+            UpSampler(int factor, int tapsPerPhase = 32);
+            void process(const SampleValue* input, int inputSampleCount, SampleValue* output) override;
+        };
+
+
+        /**
+         * Lowers the sample rate of a signal by a whole number factor by lowpass filtering and decimation.
+         * The filter output is only calculated for the samples that are kept.
+         */
+        class NAPAPI DownSampler : public Resampler
+        {
+        public:
+            DownSampler(int factor, int tapsPerPhase = 32);
+            void process(const SampleValue* input, int inputSampleCount, SampleValue* output) override;
+        };
+
+    }
+
+}
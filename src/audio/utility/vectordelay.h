@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <audio/utility/audiotypes.h>
 #include <audio/utility/audiofunctions.h>
 #include <audio/utility/vectorextension.h>
@@ -17,7 +19,7 @@ namespace nap
 		/**
 		 * Utility class representing a single delay that can be written and read from.
 		 * Supports interpolation between samples while reading.
-         * @tparam real Should be float, @float4 or @float8.
+         * @tparam real Should be float, @float4, @float8 or @float16.
 		 */
 		template <typename real>
 		class NAPAPI VectorDelay
@@ -80,6 +82,31 @@ namespace nap
 
 				return math::lerp<real>(mBuffer[integerIndex], mBuffer[nextIntegerIndex], frac);
 			}
+
+			/**
+			 * Same as @readInterpolating() with a separate delay time for each lane of a vector type.
+			 * @param sampleTime Delay time in samples for each lane
+			 */
+			template <typename T = real>
+			std::enable_if_t<!std::is_arithmetic<T>::value, real> readInterpolating(const real& sampleTime)
+			{
+				real result;
+				for (auto lane = 0; lane < int(sizeof(real) / sizeof(float)); ++lane)
+				{
+					assert(sampleTime[lane] < mBuffer.size());
+					SampleValue readIndex = mWriteIndex - sampleTime[lane] - 1;
+					while (readIndex < 0) readIndex += mBuffer.size();
+
+					unsigned int floorReadIndex = (unsigned int) readIndex;
+					unsigned int integerIndex = wrap(floorReadIndex, mBuffer.size());
+					unsigned int nextIntegerIndex = wrap(integerIndex + 1, mBuffer.size());
+
+					SampleValue frac = readIndex - floorReadIndex;
+					const SampleValue current = mBuffer[integerIndex][lane];
+					result[lane] = current + (mBuffer[nextIntegerIndex][lane] - current) * frac;
+				}
+				return result;
+			}
 			
 			/**
 			 * Clear the delay line by flushing its buffer.
@@ -35,6 +35,15 @@ namespace nap
                       tanf(valueElements[6]),
                       tanf(valueElements[7]));
     }
+    
+    
+    float16 tanVec(const float16 value)
+    {
+        float16 result;
+        for (auto i = 0; i < 16; ++i)
+            result[i] = tanf(value[i]);
+        return result;
+    }
 
     
     float4 sinVec(const float4 value)
@@ -65,6 +74,15 @@ namespace nap
     }
     
     
+    float16 sinVec(const float16 value)
+    {
+        float16 result;
+        for (auto i = 0; i < 16; ++i)
+            result[i] = sinf(value[i]);
+        return result;
+    }
+    
+    
     float4 cosVec(const float4 value)
     {
         const float * valueElements = (float*)&value;
@@ -93,6 +111,15 @@ namespace nap
     }
 
 
+    float16 cosVec(const float16 value)
+    {
+        float16 result;
+        for (auto i = 0; i < 16; ++i)
+            result[i] = cosf(value[i]);
+        return result;
+    }
+
+
 	float powVec(const float value, const float power)
 	{
 		return powf(value, power);
@@ -129,4 +156,13 @@ namespace nap
     }
 
 
+    float16 powVec(const float16 value, const float16 power)
+    {
+        float16 result;
+        for (auto i = 0; i < 16; ++i)
+            result[i] = powf(value[i], power[i]);
+        return result;
+    }
+
+
 }
@@ -6,6 +6,7 @@
 
 #include <utility/dllexport.h>
 
+#include <audio/utility/simde/x86/avx512.h>
 #include <audio/utility/simde/x86/avx2.h>
 #include <audio/utility/simde/x86/sse2.h>
 
@@ -215,16 +216,120 @@ namespace nap
         }
     };
     
+	typedef simde__m512 float16_value;
+	
+    /**
+     * Sixteen floats in one AVX-512 register. Has the same operators as float8.
+     * The operations only compile to AVX-512 instructions in code that is built with AVX-512 enabled, elsewhere they are emulated with narrower registers.
+     */
+    struct NAPAPI float16
+    {
+        float16_value value;
+        
+        float16()
+        {
+        }
+        
+        explicit float16(const int in_f)
+        {
+            const float f = (float)in_f;
+			
+			value = simde_mm512_set1_ps(f);
+        }
+        
+        explicit float16(const float f)
+        {
+			value = simde_mm512_set1_ps(f);
+        }
+        
+        explicit float16(const float f1, const float f2, const float f3, const float f4, const float f5, const float f6, const float f7, const float f8,
+                         const float f9, const float f10, const float f11, const float f12, const float f13, const float f14, const float f15, const float f16)
+        {
+			value = simde_mm512_set_ps(f16, f15, f14, f13, f12, f11, f10, f9, f8, f7, f6, f5, f4, f3, f2, f1);
+        }
+        
+        explicit float16(const double in_f)
+        {
+            const float f = (float)in_f;
+			
+			value = simde_mm512_set1_ps(f);
+        }
+        
+        explicit float16(float16_value in_value)
+        {
+            value = in_value;
+        }
+        
+        explicit float16(const float * __restrict f)
+        {
+			value = simde_mm512_loadu_ps(f);
+        }
+        
+        float16 operator+(const float16 other) const
+        {
+			return float16(simde_mm512_add_ps(value, other.value));
+        }
+        
+        float16 operator-(const float16 other) const
+        {
+			return float16(simde_mm512_sub_ps(value, other.value));
+        }
+        
+        float16 operator*(const float16 other) const
+        {
+			return float16(simde_mm512_mul_ps(value, other.value));
+        }
+        
+        float16 operator/(const float16 other) const
+        {
+			return float16(simde_mm512_div_ps(value, other.value));
+        }
+        
+        float16 operator*(const float other) const
+        {
+            return *this * float16(other);
+        }
+        
+        float16 operator*(const int other) const
+        {
+            return *this * float16(other);
+        }
+        
+        float& operator[](const int index)
+        {
+            return reinterpret_cast<float*>(&value)[index];
+        }
+        
+        bool operator==(const float16 other)
+        {
+            return simde_mm512_cmp_ps_mask(value, other.value, SIMDE_CMP_NEQ_OQ) == 0;
+        }
+        
+        bool operator!=(const float16 other)
+        {
+            return simde_mm512_cmp_ps_mask(value, other.value, SIMDE_CMP_NEQ_OQ) != 0;
+        }
+        
+        const float& operator[](const int index) const
+        {
+            return reinterpret_cast<const float*>(&value)[index];
+        }
+    };
+    
     
     float4 NAPAPI tanVec(const float4 value);
     float8 NAPAPI tanVec(const float8 value);
+    float16 NAPAPI tanVec(const float16 value);
     float4 NAPAPI sinVec(const float4 value);
     float8 NAPAPI sinVec(const float8 value);
+    float16 NAPAPI sinVec(const float16 value);
     float4 NAPAPI cosVec(const float4 value);
     float8 NAPAPI cosVec(const float8 value);
+    float16 NAPAPI cosVec(const float16 value);
 	float NAPAPI powVec(const float value, const float power);
     float4 NAPAPI powVec(const float4 value, const float4 power);
     float8 NAPAPI powVec(const float8 value, const float8 power);
+    float16 NAPAPI powVec(const float16 value, const float16 power);
 
 	inline void NAPAPI vectorAdd(float8 * __restrict destination, const float8 * __restrict a, const int vectorSize)
     {
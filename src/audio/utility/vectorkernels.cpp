@@ -0,0 +1,46 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "vectorkernels.h"
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        // Defined in the translation unit of each instruction set, nullptr when the module was not built for it
+        const VectorKernels* getBaselineVectorKernels();
+        const VectorKernels* getAVX2VectorKernels();
+        const VectorKernels* getAVX512VectorKernels();
+
+
+        const VectorKernels* getVectorKernels(InstructionSet instructionSet)
+        {
+            if (!isSupported(instructionSet))
+                return nullptr;
+
+            switch (instructionSet)
+            {
+                case InstructionSet::Baseline:
+                    return getBaselineVectorKernels();
+                case InstructionSet::AVX2:
+                    return getAVX2VectorKernels();
+                case InstructionSet::AVX512:
+                    return getAVX512VectorKernels();
+            }
+            return nullptr;
+        }
+
+
+        const VectorKernels& getVectorKernels()
+        {
+            static const VectorKernels* kernels = getVectorKernels(InstructionSet::AVX512) != nullptr ? getVectorKernels(InstructionSet::AVX512) :
+                (getVectorKernels(InstructionSet::AVX2) != nullptr ? getVectorKernels(InstructionSet::AVX2) : getBaselineVectorKernels());
+            return *kernels;
+        }
+
+    }
+
+}
@@ -0,0 +1,116 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Nap includes
+#include <utility/dllexport.h>
+
+// Audio includes
+#include <audio/utility/cpudispatch.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        /**
+         * State of up to sixteen parallel biquad filters whose coefficients are interpolated linearly over a number of samples, like BiquadFilter<float16>.
+         * Processed by VectorKernels::processBiquadBank.
+         */
+        struct NAPAPI BiquadBankState
+        {
+            static constexpr int laneCount = 16;        ///< Number of filters.
+            static constexpr int coefficientCount = 6;  ///< a0, a1, a2, b1, b2 and the output gain.
+
+            /**
+             * Starts interpolating the coefficients of all filters towards new values. Has to be called on the thread that processes the filters.
+             * @param targets Values of each coefficient for each filter.
+             */
+            void setCoefficients(const float targets[coefficientCount][laneCount])
+            {
+                for (auto coefficient = 0; coefficient < coefficientCount; ++coefficient)
+                    for (auto lane = 0; lane < laneCount; ++lane)
+                    {
+                        mTargets[coefficient][lane] = targets[coefficient][lane];
+                        mIncrements[coefficient][lane] = (targets[coefficient][lane] - mValues[coefficient][lane]) / mStepCount;
+                    }
+                mStepsRemaining = mStepCount;
+            }
+
+            alignas(64) float mValues[coefficientCount][laneCount] = { };
+            alignas(64) float mIncrements[coefficientCount][laneCount] = { };
+            alignas(64) float mTargets[coefficientCount][laneCount] = { };
+            alignas(64) float mH1[laneCount] = { };
+            alignas(64) float mH2[laneCount] = { };
+            int mStepCount = 64;        // Number of samples to interpolate coefficient changes over
+            int mStepsRemaining = 0;
+        };
+
+
+        /**
+         * Parameters of the taps read by VectorKernels::readTaps, see MultiTapReader.
+         */
+        struct NAPAPI TapReadContext
+        {
+            static constexpr int sincHalfLength = 4;    ///< Number of samples on each side of the position used by sinc interpolation.
+            static constexpr int sincPhaseCount = 256;  ///< Resolution of the fractional position in the sinc table.
+
+            const float* mSource = nullptr;     ///< Circular source buffer.
+            unsigned int mMask = 0;             ///< Size of the source buffer minus one, the size has to be a power of two.
+            double* mPositions = nullptr;       ///< Position of each tap, advanced by the kernel and kept within the source buffer.
+            const float* mSpeeds = nullptr;     ///< Speed of each tap in samples per sample.
+            const float* mGains = nullptr;      ///< Gain of each tap.
+            int mTapCount = 0;                  ///< Number of taps.
+            const float* mSincTable = nullptr;  ///< Coefficients for sincPhaseCount + 1 fractional positions, 2 * sincHalfLength per position.
+        };
+
+
+        /**
+         * Table of the hot inner loops of the module, compiled once for each InstructionSet.
+         * The table for the processor is selected when getVectorKernels() is first called, so a single binary uses AVX2 or AVX-512 on machines that have it regardless of the build flags.
+         * All kernels produce the same results on every instruction set up to rounding.
+         */
+        struct NAPAPI VectorKernels
+        {
+            InstructionSet mInstructionSet = InstructionSet::Baseline; ///< Instruction set the kernels were compiled for.
+
+            /**
+             * Adds a buffer multiplied by a gain to another buffer.
+             * @param destination Receives the sum.
+             * @param source Buffer that is mixed into destination.
+             * @param gain Gain of the source.
+             * @param count Number of samples.
+             */
+            void (*mix)(float* destination, const float* source, float gain, int count);
+
+            /**
+             * Processes a block of a mono input through the filters of a BiquadBankState and writes the sum of the outputs of the first filterCount filters.
+             * Only the vectors that contain the first filterCount filters are processed. The coefficients of the other filters are set to their targets and their state is cleared, so they start cleanly when the filter count is raised.
+             */
+            void (*processBiquadBank)(BiquadBankState& state, const float* input, float* output, int count, int filterCount);
+
+            /**
+             * Reads the taps of a TapReadContext with linear, Hermite or sinc interpolation, writes their sum and advances their positions.
+             */
+            void (*readTapsLinear)(TapReadContext& context, float* output, int sampleCount);
+            void (*readTapsHermite)(TapReadContext& context, float* output, int sampleCount);
+            void (*readTapsSinc)(TapReadContext& context, float* output, int sampleCount);
+        };
+
+
+        /**
+         * @return The kernels for the most extended instruction set that is supported by the processor and that the module was built for.
+         */
+        NAPAPI const VectorKernels& getVectorKernels();
+
+        /**
+         * @return The kernels for a specific instruction set, or nullptr if the module was not built for it or the processor does not support it.
+         */
+        NAPAPI const VectorKernels* getVectorKernels(InstructionSet instructionSet);
+
+    }
+
+}
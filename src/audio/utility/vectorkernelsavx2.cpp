@@ -0,0 +1,77 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Compiled with AVX2 and FMA enabled, see module_extra.cmake. Without those flags the kernels are left out.
+
+// Audio includes
+#include <audio/utility/vectorkernels.h>
+
+#if defined(__AVX2__)
+
+// Audio includes
+#include <audio/utility/simde/x86/avx2.h>
+#include <audio/utility/simde/x86/fma.h>
+#include <audio/utility/vectorkernelsimpl.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+
+            struct Vec8
+            {
+                using Type = simde__m256;
+                static constexpr int width = 8;
+
+                static Type load(const float* value) { return simde_mm256_loadu_ps(value); }
+                static void store(float* destination, Type value) { simde_mm256_storeu_ps(destination, value); }
+                static Type set(float value) { return simde_mm256_set1_ps(value); }
+                static Type add(Type a, Type b) { return simde_mm256_add_ps(a, b); }
+                static Type sub(Type a, Type b) { return simde_mm256_sub_ps(a, b); }
+                static Type mul(Type a, Type b) { return simde_mm256_mul_ps(a, b); }
+                static Type multiplyAdd(Type a, Type b, Type c) { return simde_mm256_fmadd_ps(a, b, c); }
+
+                static float sum(Type value)
+                {
+                    auto quad = simde_mm_add_ps(simde_mm256_castps256_ps128(value), simde_mm256_extractf128_ps(value, 1));
+                    auto pairs = simde_mm_add_ps(quad, simde_mm_movehl_ps(quad, quad));
+                    return simde_mm_cvtss_f32(simde_mm_add_ss(pairs, simde_mm_shuffle_ps(pairs, pairs, 1)));
+                }
+            };
+
+        }
+
+
+        const VectorKernels* getAVX2VectorKernels()
+        {
+            static const VectorKernels kernels = makeVectorKernels<Vec8>(InstructionSet::AVX2);
+            return &kernels;
+        }
+
+    }
+
+}
+
+#else
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        const VectorKernels* getAVX2VectorKernels()
+        {
+            return nullptr;
+        }
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,77 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Compiled with AVX-512 enabled, see module_extra.cmake. Without those flags the kernels are left out.
+
+// Audio includes
+#include <audio/utility/vectorkernels.h>
+
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+
+// Audio includes
+#include <audio/utility/simde/x86/avx512.h>
+#include <audio/utility/vectorkernelsimpl.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+
+            struct Vec16
+            {
+                using Type = simde__m512;
+                static constexpr int width = 16;
+
+                static Type load(const float* value) { return simde_mm512_loadu_ps(value); }
+                static void store(float* destination, Type value) { simde_mm512_storeu_ps(destination, value); }
+                static Type set(float value) { return simde_mm512_set1_ps(value); }
+                static Type add(Type a, Type b) { return simde_mm512_add_ps(a, b); }
+                static Type sub(Type a, Type b) { return simde_mm512_sub_ps(a, b); }
+                static Type mul(Type a, Type b) { return simde_mm512_mul_ps(a, b); }
+                static Type multiplyAdd(Type a, Type b, Type c) { return simde_mm512_fmadd_ps(a, b, c); }
+
+                static float sum(Type value)
+                {
+                    auto quad = simde_mm_add_ps(simde_mm_add_ps(simde_mm512_castps512_ps128(value), simde_mm512_extractf32x4_ps(value, 1)),
+                                                simde_mm_add_ps(simde_mm512_extractf32x4_ps(value, 2), simde_mm512_extractf32x4_ps(value, 3)));
+                    auto pairs = simde_mm_add_ps(quad, simde_mm_movehl_ps(quad, quad));
+                    return simde_mm_cvtss_f32(simde_mm_add_ss(pairs, simde_mm_shuffle_ps(pairs, pairs, 1)));
+                }
+            };
+
+        }
+
+
+        const VectorKernels* getAVX512VectorKernels()
+        {
+            static const VectorKernels kernels = makeVectorKernels<Vec16>(InstructionSet::AVX512);
+            return &kernels;
+        }
+
+    }
+
+}
+
+#else
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        const VectorKernels* getAVX512VectorKernels()
+        {
+            return nullptr;
+        }
+
+    }
+
+}
+
+#endif
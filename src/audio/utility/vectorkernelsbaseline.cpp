@@ -0,0 +1,51 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Compiled with the build flags of the module
+
+// Audio includes
+#include <audio/utility/simde/x86/sse2.h>
+#include <audio/utility/vectorkernelsimpl.h>
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+
+            struct Vec4
+            {
+                using Type = simde__m128;
+                static constexpr int width = 4;
+
+                static Type load(const float* value) { return simde_mm_loadu_ps(value); }
+                static void store(float* destination, Type value) { simde_mm_storeu_ps(destination, value); }
+                static Type set(float value) { return simde_mm_set1_ps(value); }
+                static Type add(Type a, Type b) { return simde_mm_add_ps(a, b); }
+                static Type sub(Type a, Type b) { return simde_mm_sub_ps(a, b); }
+                static Type mul(Type a, Type b) { return simde_mm_mul_ps(a, b); }
+                static Type multiplyAdd(Type a, Type b, Type c) { return simde_mm_add_ps(simde_mm_mul_ps(a, b), c); }
+
+                static float sum(Type value)
+                {
+                    auto pairs = simde_mm_add_ps(value, simde_mm_movehl_ps(value, value));
+                    return simde_mm_cvtss_f32(simde_mm_add_ss(pairs, simde_mm_shuffle_ps(pairs, pairs, 1)));
+                }
+            };
+
+        }
+
+
+        const VectorKernels* getBaselineVectorKernels()
+        {
+            static const VectorKernels kernels = makeVectorKernels<Vec4>(InstructionSet::Baseline);
+            return &kernels;
+        }
+
+    }
+
+}
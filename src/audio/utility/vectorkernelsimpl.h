@@ -0,0 +1,234 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+// Audio includes
+#include <audio/utility/vectorkernels.h>
+
+/**
+ * Bodies of the VectorKernels, included by the translation unit of each instruction set.
+ * The kernels are templates on a vector traits struct that the including file defines with:
+ * - Type: the vector register type
+ * - width: the number of lanes
+ * - load(), store(), set(), add(), sub(), mul() and multiplyAdd(a, b, c) that returns a * b + c
+ * - sum(): the sum of all lanes
+ * Everything is in an unnamed namespace so each instruction set gets its own copy.
+ * Do not use inline functions with external linkage here, like std::min or the members of float8,
+ * the linker could pick the AVX version for callers compiled for the baseline.
+ */
+
+namespace nap
+{
+
+    namespace audio
+    {
+
+        namespace
+        {
+
+            template <typename Vec>
+            void mix(float* destination, const float* source, float gain, int count)
+            {
+                const auto vectorGain = Vec::set(gain);
+                auto i = 0;
+                for (; i + Vec::width <= count; i += Vec::width)
+                    Vec::store(destination + i, Vec::multiplyAdd(Vec::load(source + i), vectorGain, Vec::load(destination + i)));
+                for (; i < count; ++i)
+                    destination[i] += source[i] * gain;
+            }
+
+
+            template <typename Vec>
+            void processBiquadBank(BiquadBankState& state, const float* input, float* output, int count, int filterCount)
+            {
+                static_assert(BiquadBankState::laneCount % Vec::width == 0, "Vector width has to divide the number of filters");
+                constexpr int vectorCount = BiquadBankState::laneCount / Vec::width;
+                using Type = typename Vec::Type;
+
+                Type values[BiquadBankState::coefficientCount][vectorCount];
+                Type h1[vectorCount];
+                Type h2[vectorCount];
+                Type mask[vectorCount];
+
+                alignas(64) float laneMask[BiquadBankState::laneCount];
+                for (auto lane = 0; lane < BiquadBankState::laneCount; ++lane)
+                    laneMask[lane] = (lane < filterCount) ? 1.f : 0.f;
+                const int activeCount = (filterCount + Vec::width - 1) / Vec::width;
+
+                for (auto v = 0; v < activeCount; ++v)
+                {
+                    for (auto coefficient = 0; coefficient < BiquadBankState::coefficientCount; ++coefficient)
+                        values[coefficient][v] = Vec::load(&state.mValues[coefficient][v * Vec::width]);
+                    h1[v] = Vec::load(&state.mH1[v * Vec::width]);
+                    h2[v] = Vec::load(&state.mH2[v * Vec::width]);
+                    mask[v] = Vec::load(&laneMask[v * Vec::width]);
+                }
+
+                for (auto i = 0; i < count; ++i)
+                {
+                    // Same interpolation as LinearSmoothedValue, which lands exactly on the target
+                    if (state.mStepsRemaining > 0)
+                    {
+                        state.mStepsRemaining--;
+                        for (auto coefficient = 0; coefficient < BiquadBankState::coefficientCount; ++coefficient)
+                            for (auto v = 0; v < activeCount; ++v)
+                                values[coefficient][v] = (state.mStepsRemaining > 0) ?
+                                    Vec::add(values[coefficient][v], Vec::load(&state.mIncrements[coefficient][v * Vec::width])) :
+                                    Vec::load(&state.mTargets[coefficient][v * Vec::width]);
+                    }
+
+                    const auto x = Vec::set(input[i]);
+                    auto sum = Vec::set(0.f);
+                    for (auto v = 0; v < activeCount; ++v)
+                    {
+                        auto result = Vec::multiplyAdd(x, values[0][v], h1[v]);
+                        h1[v] = Vec::sub(Vec::multiplyAdd(x, values[1][v], h2[v]), Vec::mul(values[3][v], result));
+                        h2[v] = Vec::sub(Vec::mul(x, values[2][v]), Vec::mul(values[4][v], result));
+                        sum = Vec::multiplyAdd(Vec::mul(result, values[5][v]), mask[v], sum);
+                    }
+                    output[i] = Vec::sum(sum);
+                }
+
+                for (auto v = 0; v < activeCount; ++v)
+                {
+                    for (auto coefficient = 0; coefficient < BiquadBankState::coefficientCount; ++coefficient)
+                        Vec::store(&state.mValues[coefficient][v * Vec::width], values[coefficient][v]);
+                    Vec::store(&state.mH1[v * Vec::width], h1[v]);
+                    Vec::store(&state.mH2[v * Vec::width], h2[v]);
+                }
+
+                // Inactive filters are not interpolated, they are kept at their targets with a cleared state so they start without a stale ramp when the filter count is raised
+                for (auto lane = activeCount * Vec::width; lane < BiquadBankState::laneCount; ++lane)
+                {
+                    for (auto coefficient = 0; coefficient < BiquadBankState::coefficientCount; ++coefficient)
+                        state.mValues[coefficient][lane] = state.mTargets[coefficient][lane];
+                    state.mH1[lane] = 0.f;
+                    state.mH2[lane] = 0.f;
+                }
+            }
+
+
+            enum class Interpolation { Linear, Hermite, Sinc };
+
+
+            template <typename Vec, Interpolation interpolation>
+            void readTaps(TapReadContext& context, float* output, int sampleCount)
+            {
+                constexpr int sincLength = 2 * TapReadContext::sincHalfLength;
+                constexpr int sampleRows = (interpolation == Interpolation::Linear) ? 2 : ((interpolation == Interpolation::Hermite) ? 4 : sincLength);
+                const double size = double(context.mMask) + 1.0;
+                const int groupCount = (context.mTapCount + Vec::width - 1) / Vec::width;
+
+                alignas(64) float samples[sampleRows][Vec::width];
+                alignas(64) float coefficients[sincLength][Vec::width];
+                alignas(64) float fractions[Vec::width];
+                alignas(64) float gains[Vec::width];
+
+                for (auto i = 0; i < sampleCount; ++i)
+                {
+                    auto sum = Vec::set(0.f);
+
+                    for (auto group = 0; group < groupCount; ++group)
+                    {
+                        const int first = group * Vec::width;
+
+                        // Gather the samples around the position of each lane, lanes beyond the tap count read silence at gain 0
+                        for (auto lane = 0; lane < Vec::width; ++lane)
+                        {
+                            const int tap = first + lane;
+                            const bool active = tap < context.mTapCount;
+                            double position = active ? context.mPositions[tap] : 0.0;
+                            gains[lane] = active ? context.mGains[tap] : 0.f;
+                            unsigned int index = (unsigned int)position;
+                            float fraction = float(position - index);
+                            fractions[lane] = fraction;
+
+                            if (interpolation == Interpolation::Linear)
+                            {
+                                samples[0][lane] = context.mSource[index & context.mMask];
+                                samples[1][lane] = context.mSource[(index + 1) & context.mMask];
+                            }
+                            else if (interpolation == Interpolation::Hermite)
+                            {
+                                for (auto k = 0; k < 4; ++k)
+                                    samples[k][lane] = context.mSource[(index + k - 1) & context.mMask];
+                            }
+                            else {
+                                const float* phase = &context.mSincTable[int(fraction * TapReadContext::sincPhaseCount + 0.5f) * sincLength];
+                                for (auto k = 0; k < sincLength; ++k)
+                                {
+                                    samples[k][lane] = context.mSource[(index + k - TapReadContext::sincHalfLength + 1) & context.mMask];
+                                    coefficients[k][lane] = phase[k];
+                                }
+                            }
+                        }
+
+                        // Interpolate all lanes at once
+                        typename Vec::Type value;
+                        const auto t = Vec::load(fractions);
+                        if (interpolation == Interpolation::Linear)
+                        {
+                            const auto x0 = Vec::load(samples[0]);
+                            const auto x1 = Vec::load(samples[1]);
+                            value = Vec::multiplyAdd(t, Vec::sub(x1, x0), x0);
+                        }
+                        else if (interpolation == Interpolation::Hermite)
+                        {
+                            const auto xm1 = Vec::load(samples[0]);
+                            const auto x0 = Vec::load(samples[1]);
+                            const auto x1 = Vec::load(samples[2]);
+                            const auto x2 = Vec::load(samples[3]);
+                            const auto c1 = Vec::mul(Vec::sub(x1, xm1), Vec::set(0.5f));
+                            const auto c2 = Vec::sub(Vec::add(Vec::sub(xm1, Vec::mul(x0, Vec::set(2.5f))), Vec::mul(x1, Vec::set(2.f))), Vec::mul(x2, Vec::set(0.5f)));
+                            const auto c3 = Vec::add(Vec::mul(Vec::sub(x2, xm1), Vec::set(0.5f)), Vec::mul(Vec::sub(x0, x1), Vec::set(1.5f)));
+                            value = Vec::multiplyAdd(Vec::multiplyAdd(Vec::multiplyAdd(c3, t, c2), t, c1), t, x0);
+                        }
+                        else {
+                            value = Vec::mul(Vec::load(samples[0]), Vec::load(coefficients[0]));
+                            for (auto k = 1; k < sincLength; ++k)
+                                value = Vec::multiplyAdd(Vec::load(samples[k]), Vec::load(coefficients[k]), value);
+                        }
+
+                        sum = Vec::multiplyAdd(value, Vec::load(gains), sum);
+
+                        // Advance the positions and keep them within the source buffer
+                        const int laneEnd = (context.mTapCount - first < Vec::width) ? context.mTapCount - first : Vec::width;
+                        for (auto lane = 0; lane < laneEnd; ++lane)
+                        {
+                            double& position = context.mPositions[first + lane];
+                            position += context.mSpeeds[first + lane];
+                            if (position >= size)
+                                position -= size;
+                            else if (position < 0.0)
+                                position += size;
+                        }
+                    }
+
+                    output[i] = Vec::sum(sum);
+                }
+            }
+
+
+            /**
+             * @return The kernel table for vector traits Vec.
+             */
+            template <typename Vec>
+            VectorKernels makeVectorKernels(InstructionSet instructionSet)
+            {
+                VectorKernels result;
+                result.mInstructionSet = instructionSet;
+                result.mix = &mix<Vec>;
+                result.processBiquadBank = &processBiquadBank<Vec>;
+                result.readTapsLinear = &readTaps<Vec, Interpolation::Linear>;
+                result.readTapsHermite = &readTaps<Vec, Interpolation::Hermite>;
+                result.readTapsSinc = &readTaps<Vec, Interpolation::Sinc>;
+                return result;
+            }
+
+        }
+
+    }
+
+}